@@ -1,84 +1,254 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <thread>
 #include <utility>
 #include <string>
 #include <iostream>
 #include <cassert>
 #include "plot.hpp"
+#include "../include/random.hpp"
+#include "../tests/chrono/benchmark.hpp"
+
+
+namespace {
+    constexpr int plot_steps = 20;
+    constexpr int plot_repetitions = 5;
+    constexpr size_t plot_queries = 256;      // get/remove: случайных обращений на шаг (у списков они O(n))
+    constexpr size_t plot_min_ops = 20000;    // операций в одной выборке: на малых размерах - несколько проходов
+
+    const char *const plot_operations[] = {"insert", "get", "remove", "iterate"};
+
+    template<typename Struct>
+    constexpr bool plot_keyed = std::is_same_v<Struct, HashTable<int, int>> ||
+                                std::is_same_v<Struct, std::unordered_map<int, int>> ||
+                                std::is_same_v<Struct, HashSet<int>> || std::is_same_v<Struct, std::set<int>>;
+
+    template<typename Struct>
+    constexpr bool plot_std_sequence = std::is_same_v<Struct, std::vector<int>> ||
+                                       std::is_same_v<Struct, std::list<int>>;
+
+    template<typename Struct>
+    void plotInsert(Struct &test_struct, int value) {
+        if constexpr (plot_std_sequence<Struct>) {
+            test_struct.push_back(value);
+        } else if constexpr (std::is_same_v<Struct, std::set<int>> ||
+                             std::is_same_v<Struct, std::unordered_map<int, int>>) {
+            test_struct.insert({value, value});
+        } else if constexpr (std::is_same_v<Struct, HashTable<int, int>>) {
+            test_struct.insert(value, value);
+        } else {
+            test_struct.add(value);
+        }
+    }
 
+    // query - ключ для ассоциативных контейнеров и индекс для последовательностей
+    template<typename Struct>
+    int plotGet(const Struct &test_struct, int query) {
+        if constexpr (std::is_same_v<Struct, HashTable<int, int>>) {
+            return test_struct.get(query);
+        } else if constexpr (std::is_same_v<Struct, std::unordered_map<int, int>>) {
+            return test_struct.at(query);
+        } else if constexpr (std::is_same_v<Struct, HashSet<int>>) {
+            return test_struct.contains(query);
+        } else if constexpr (std::is_same_v<Struct, std::set<int>>) {
+            return *test_struct.find(query);
+        } else if constexpr (std::is_same_v<Struct, std::vector<int>>) {
+            return test_struct[query];
+        } else if constexpr (std::is_same_v<Struct, std::list<int>>) {
+            return *std::next(test_struct.begin(), query);
+        } else {
+            return test_struct.get(query);
+        }
+    }
 
-template<typename Struct>
-std::vector<Dot> cppPlotCore(int values) {
-    std::vector<Dot> datasort;
-    Struct test_struct;
-    const int step = values / 20;
-    std::cout << "Generating plot data..." << std::endl;
-
-    for (int i = step; i <= values; i += step) {
-        std::vector<int> data;
-        for (size_t j = 0; j < i; ++j) {
-            data.push_back(j);
+    template<typename Struct>
+    void plotRemove(Struct &test_struct, int query) {
+        if constexpr (std::is_same_v<Struct, std::unordered_map<int, int>> || std::is_same_v<Struct, std::set<int>>) {
+            test_struct.erase(query);
+        } else if constexpr (plot_std_sequence<Struct>) {
+            test_struct.erase(std::next(test_struct.begin(), query));
+        } else {
+            test_struct.remove(query);
         }
-        auto start = std::chrono::high_resolution_clock::now();
-        if constexpr (std::is_same_v<Struct, std::vector<int>> || std::is_same_v<Struct, std::list<int>>) {
-            for (const auto &value: data) {
-                test_struct.push_back(value);
-            }
-        } else if constexpr (std::is_same_v<Struct, std::set<int>>) {
-            for (const auto &value: data) {
-                test_struct.insert(value);
-            }
-        } else if constexpr (std::is_same_v<Struct, HashTable<int, int>>) {
-            for (const auto &value: data) {
-                test_struct.insert(value, value);
-            }
-        } else if constexpr (std::is_same_v<Struct, std::unordered_map<int, int>>) {
-            for (const auto &value: data) {
-                test_struct[values] = values;
-            }
+    }
+
+    template<typename Item>
+    int plotItemValue(const Item &item) {
+        if constexpr (std::is_arithmetic_v<Item>) {
+            return item;
         } else {
-            for (const auto &value: data) {
-                test_struct.add(value);
-            }
+            return static_cast<int>(item.first);
         }
-        auto end = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<double, std::milli> duration = end - start;
+    }
 
-        datasort.push_back({i, duration.count()});
+    template<typename Struct>
+    Struct plotFilled(const std::vector<int> &values) {
+        Struct test_struct;
+        for (int value: values) {
+            plotInsert(test_struct, value);
+        }
+        return test_struct;
     }
 
-    std::cout << "Part of plot is completed!\n" << std::endl;
-    return datasort;
+    // Медиана и разброс по повторам времени на одну операцию. Каждый проход получает состояние от setup
+    // (вне замера, из времени прохода вычитается цена вызова часов); проходов в выборке столько,
+    // чтобы набралось plot_min_ops операций
+    template<typename Setup, typename Body>
+    Dot plotMeasure(int size, size_t ops, Setup setup, Body body) {
+        using Clock = std::chrono::steady_clock;
+        size_t passes = std::max<size_t>(1, plot_min_ops / std::max<size_t>(ops, 1));
+        double overhead = clockOverheadNs();
+        std::vector<double> samples;
+        for (int repetition = 0; repetition < plot_repetitions; ++repetition) {
+            double total = 0;
+            for (size_t pass = 0; pass < passes; ++pass) {
+                decltype(auto) state = setup();
+                clobberMemory();
+                auto start = Clock::now();
+                body(state);
+                clobberMemory();
+                auto end = Clock::now();
+                total += std::max(0.0, std::chrono::duration<double, std::nano>(end - start).count() - overhead);
+            }
+            samples.push_back(total / static_cast<double>(passes * std::max<size_t>(ops, 1)));
+        }
+        BenchmarkResult summary = summarizeSamples(BenchmarkCase(), 1, passes, samples);
+        return {size, summary.median_ns, summary.stddev_ns};
+    }
+
+    void plotShuffle(std::vector<int> &values, RandomEngine &rng) {
+        for (size_t i = values.size(); i > 1; --i) {
+            std::swap(values[i - 1], values[rng.uniformIndex(i)]);
+        }
+    }
 }
 
-void plotLegend(sf::RenderWindow &window, sf::Font &font, const Sequence<DataSeries> &series) {
-    std::vector<std::pair<std::string, sf::Color>> legends;
-    for (const auto &item: series) {
-        legends.emplace_back(item.title, item.color);
+// Один шаг графика: insert, get, remove и iterate на свежих контейнерах из size элементов, в нс на операцию.
+// emit(номер операции, точка) вернул false - шаг прерывается
+template<typename Struct>
+bool cppPlotCore(int size, const std::function<bool(size_t, const Dot &)> &emit) {
+    RandomEngine rng(RngEngine::Xoshiro256, static_cast<uint64_t>(size));
+    std::vector<int> values(size);
+    for (int i = 0; i < size; ++i) {
+        values[i] = i;
+    }
+    plotShuffle(values, rng);
+
+    // get: случайные ключи/индексы; remove: различные ключи или индексы, допустимые для уменьшающегося размера
+    size_t queries = std::min<size_t>(plot_queries, static_cast<size_t>(size));
+    std::vector<int> get_queries(queries);
+    std::vector<int> remove_queries(queries);
+    for (size_t i = 0; i < queries; ++i) {
+        get_queries[i] = static_cast<int>(rng.uniformIndex(size));
+        remove_queries[i] = plot_keyed<Struct> ? values[i] : static_cast<int>(rng.uniformIndex(size - i));
+    }
+
+    Struct filled = plotFilled<Struct>(values);
+    if (!emit(0, plotMeasure(size, values.size(), [] { return Struct(); }, [&values](Struct &test_struct) {
+        for (int value: values) {
+            plotInsert(test_struct, value);
+        }
+        doNotOptimize(test_struct);
+    }))) {
+        return false;
+    }
+    if (!emit(1, plotMeasure(size, queries, [&filled]() -> const Struct & { return filled; },
+                             [&get_queries](const Struct &test_struct) {
+                                 long long sum = 0;
+                                 for (int query: get_queries) {
+                                     sum += plotGet(test_struct, query);
+                                 }
+                                 doNotOptimize(sum);
+                             }))) {
+        return false;
     }
-//    legends = {
-//            {series[0].title, series[0].color},
-//            {series[1].title, series[1].color}
-//    };
+    if (!emit(2, plotMeasure(size, queries, [&filled] { return filled; }, [&remove_queries](Struct &test_struct) {
+        for (int query: remove_queries) {
+            plotRemove(test_struct, query);
+        }
+        doNotOptimize(test_struct);
+    }))) {
+        return false;
+    }
+    return emit(3, plotMeasure(size, values.size(), [&filled]() -> const Struct & { return filled; },
+                               [](const Struct &test_struct) {
+                                   long long sum = 0;
+                                   for (const auto &item: test_struct) {
+                                       sum += plotItemValue(item);
+                                   }
+                                   doNotOptimize(sum);
+                               }));
+}
+
+PlotFeed::PlotFeed(const Sequence<DataSeries> &series, size_t expected_points)
+        : series(series), cancel_requested(false) {
+    progress.expected = expected_points;
+}
+
+void PlotFeed::add(size_t index, const Dot &dot) {
+    std::lock_guard<std::mutex> lock(mutex);
+    series[index].data.push_back(dot);
+    ++progress.received;
+}
+
+void PlotFeed::setTitle(size_t index, const std::string &title) {
+    std::lock_guard<std::mutex> lock(mutex);
+    series[index].title = title;
+}
+
+void PlotFeed::setStatus(const std::string &status) {
+    std::lock_guard<std::mutex> lock(mutex);
+    progress.status = status;
+}
+
+void PlotFeed::finish() {
+    std::lock_guard<std::mutex> lock(mutex);
+    progress.finished = true;
+}
+
+void PlotFeed::cancel() {
+    cancel_requested = true;
+}
+
+bool PlotFeed::cancelled() const {
+    return cancel_requested;
+}
+
+Sequence<DataSeries> PlotFeed::snapshot(PlotProgress &state) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    state = progress;
+    return series;
+}
 
+void plotLegend(sf::RenderWindow &window, sf::Font &font, const Sequence<DataSeries> &series) {
     float legend_x = 50.f;
     float legend_y = 10.f;
 
-    for (const auto &legend: legends) {
+    // Много рядов - легенда переносится на следующую строку
+    for (const auto &item: series) {
         sf::Text legend_text;
         legend_text.setFont(font);
-        legend_text.setString(legend.first);
+        legend_text.setString(item.title);
         legend_text.setCharacterSize(14);
-        legend_text.setFillColor(legend.second);
+        legend_text.setFillColor(item.color);
+        float width = legend_text.getLocalBounds().width;
+        if (legend_x > 50.f && legend_x + width > window.getSize().x - 10.f) {
+            legend_x = 50.f;
+            legend_y += 18.f;
+        }
         legend_text.setPosition(legend_x, legend_y);
         window.draw(legend_text);
-        legend_x += legend_text.getLocalBounds().width + 20.f;
+        legend_x += width + 20.f;
     }
 }
 
-void plotAxes(sf::RenderWindow &window, sf::Font &font, float padding) {
+void plotAxes(sf::RenderWindow &window, sf::Font &font, float padding, const std::string &x_title,
+              const std::string &y_title) {
     // axis Ox
     sf::Text x_label;
     x_label.setFont(font);
-    x_label.setString("Amount of data, counts");
+    x_label.setString(x_title);
     x_label.setCharacterSize(16);
     x_label.setFillColor(sf::Color::Black);
     x_label.setPosition(window.getSize().x / 2 - 70, window.getSize().y - padding + 30);
@@ -87,7 +257,7 @@ void plotAxes(sf::RenderWindow &window, sf::Font &font, float padding) {
     // axis Oy
     sf::Text y_label;
     y_label.setFont(font);
-    y_label.setString("Time, mls");
+    y_label.setString(y_title);
     y_label.setCharacterSize(16);
     y_label.setFillColor(sf::Color::Black);
     y_label.setPosition(padding - 50, window.getSize().y / 2 - 100);
@@ -95,124 +265,336 @@ void plotAxes(sf::RenderWindow &window, sf::Font &font, float padding) {
     window.draw(y_label);
 }
 
-template<typename TStruct, typename StdStruct>
-void plotInit(int values, Sequence<DataSeries> &series) {
-    series[0].data = cppPlotCore<TStruct>(values);
-    series[1].data = cppPlotCore<StdStruct>(values);
-
-    vector<Dot> coordinates_1 = series[0].data;
-    vector<Dot> coordinates_2 = series[1].data;
-
-    const int window_width = 800;
-    const int window_height = 600;
-    sf::RenderWindow window(sf::VideoMode(window_width, window_height), "Chrono of structures");
-
-    float min_x = coordinates_1[0].x, max_x = coordinates_1[0].x;
-    float min_y = coordinates_1[0].y, max_y = coordinates_1[0].y;
-    for (const auto &coords: {coordinates_1, coordinates_2}) {
-        for (const auto &coord: coords) {
-            if (coord.x < min_x) min_x = coord.x;
-            if (coord.x > max_x) max_x = coord.x;
-            if (coord.y < min_y) min_y = coord.y;
-            if (coord.y > max_y) max_y = coord.y;
+namespace {
+    std::string plotTick(double value) {
+        char buffer[32];
+        if (std::fabs(value) >= 1000 || value == std::floor(value)) {
+            std::snprintf(buffer, sizeof(buffer), "%.0f", value);
+        } else {
+            std::snprintf(buffer, sizeof(buffer), "%.3g", value);
         }
+        return buffer;
     }
 
-    const float padding = 50.f;
-    float scale_x = (window.getSize().x - 2 * padding) / (max_x - min_x);
-    float scale_y = (window.getSize().y - 2 * padding) / (max_y - min_y);
+    void plotProgress(sf::RenderWindow &window, sf::Font &font, float padding, const PlotProgress &progress) {
+        if (progress.expected == 0) {
+            return;
+        }
+        std::string status = progress.finished ? "Done: " : "Running: ";
+        status += std::to_string(progress.received) + " / " + std::to_string(progress.expected) + " points";
+        sf::Text text;
+        text.setFont(font);
+        text.setString(status);
+        text.setCharacterSize(12);
+        text.setFillColor(sf::Color::Black);
+        text.setPosition(window.getSize().x - padding - 150, window.getSize().y - 18.f);
+        window.draw(text);
+
+        if (!progress.status.empty()) {
+            sf::Text message;
+            message.setFont(font);
+            message.setString(progress.status);
+            message.setCharacterSize(12);
+            message.setFillColor(sf::Color(90, 90, 90));
+            message.setPosition(window.getSize().x - padding - 160 - message.getLocalBounds().width,
+                                window.getSize().y - 18.f);
+            window.draw(message);
+        }
 
-    sf::Font font;
-    if (!font.loadFromFile("../externallibs/font.ttf")) {
+        float width = 150.f;
+        float share = std::min(1.f, static_cast<float>(progress.received) / static_cast<float>(progress.expected));
+        sf::RectangleShape frame(sf::Vector2f(width, 4.f));
+        frame.setPosition(window.getSize().x - padding - 150, window.getSize().y - 22.f);
+        frame.setFillColor(sf::Color(220, 220, 220));
+        window.draw(frame);
+        sf::RectangleShape bar(sf::Vector2f(width * (progress.finished ? 1.f : share), 4.f));
+        bar.setPosition(frame.getPosition());
+        bar.setFillColor(progress.finished ? sf::Color(0, 160, 0) : sf::Color(0, 120, 255));
+        window.draw(bar);
     }
 
-    sf::Vector2f offset(0.f, 0.f);
-    bool is_dragging = false;
-    sf::Vector2i previous_mouse_position;
+    // Окно графика: каждый кадр берёт копию рядов из feed, пересчитывает границы и рисует их заново
+    void plotWindow(PlotFeed &feed, const PlotOptions &options) {
+        const int window_width = 800;
+        const int window_height = 600;
+
+        sf::RenderWindow window(sf::VideoMode(window_width, window_height), "Chrono of structures");
+        window.setFramerateLimit(30);
 
-    while (window.isOpen()) {
-        sf::Event event;
-        while (window.pollEvent(event)) {
-            if (event.type == sf::Event::Closed ||
-                (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape))
-                window.close();
+        const float padding = 50.f;
 
-            if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
-                is_dragging = true;
-                previous_mouse_position = sf::Mouse::getPosition(window);
+        sf::Font font;
+        if (!font.loadFromFile("../externallibs/font.ttf")) {
+        }
+
+        sf::Vector2f offset(0.f, 0.f);
+        bool is_dragging = false;
+        sf::Vector2i previous_mouse_position;
+        bool log_x = options.log_x;
+        bool log_y = options.log_y;
+
+        while (window.isOpen()) {
+            sf::Event event;
+            while (window.pollEvent(event)) {
+                if (event.type == sf::Event::Closed ||
+                    (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape))
+                    window.close();
+
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::X) {
+                    log_x = !log_x;
+                }
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Y) {
+                    log_y = !log_y;
+                }
+                if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
+                    is_dragging = true;
+                    previous_mouse_position = sf::Mouse::getPosition(window);
+                }
+                if (event.type == sf::Event::MouseButtonReleased && event.mouseButton.button == sf::Mouse::Left) {
+                    is_dragging = false;
+                }
+                if (event.type == sf::Event::MouseMoved && is_dragging) {
+                    sf::Vector2i current_mouse_position = sf::Mouse::getPosition(window);
+                    offset.x += (current_mouse_position.x - previous_mouse_position.x);
+                    offset.y += (current_mouse_position.y - previous_mouse_position.y);
+                    previous_mouse_position = current_mouse_position;
+                }
             }
-            if (event.type == sf::Event::MouseButtonReleased && event.mouseButton.button == sf::Mouse::Left) {
-                is_dragging = false;
+            if (!window.isOpen()) {
+                break;
             }
-            if (event.type == sf::Event::MouseMoved && is_dragging) {
-                sf::Vector2i current_mouse_position = sf::Mouse::getPosition(window);
-                offset.x += (current_mouse_position.x - previous_mouse_position.x);
-                offset.y += (current_mouse_position.y - previous_mouse_position.y);
-                previous_mouse_position = current_mouse_position;
+
+            PlotProgress progress;
+            Sequence<DataSeries> series = feed.snapshot(progress);
+
+            // В логарифмической шкале точки с неположительной координатой не рисуются
+            auto to_x = [log_x](double value) { return log_x ? std::log10(value) : value; };
+            auto to_y = [log_y](double value) { return log_y ? std::log10(value) : value; };
+            auto visible = [log_x, log_y](const Dot &dot) { return (!log_x || dot.x > 0) && (!log_y || dot.y > 0); };
+
+            bool empty = true;
+            double min_x = 0, max_x = 0;
+            double min_y = 0, max_y = 0;
+            for (const auto &item: series) {
+                for (const auto &coord: item.data) {
+                    if (!visible(coord)) {
+                        continue;
+                    }
+                    double x = to_x(coord.x);
+                    double low = coord.y - coord.error;
+                    double y_low = to_y(low > 0 || !log_y ? low : coord.y);
+                    double y_high = to_y(coord.y + coord.error);
+                    if (empty) {
+                        min_x = max_x = x;
+                        min_y = y_low;
+                        max_y = y_high;
+                        empty = false;
+                    }
+                    min_x = std::min(min_x, x);
+                    max_x = std::max(max_x, x);
+                    min_y = std::min(min_y, y_low);
+                    max_y = std::max(max_y, y_high);
+                }
+            }
+            // Одна точка или горизонтальная линия: оси не должны вырождаться
+            if (max_x == min_x) max_x = min_x + 1;
+            if (max_y == min_y) max_y = min_y + 1;
+
+            float scale_x = (window.getSize().x - 2 * padding) / static_cast<float>(max_x - min_x);
+            float scale_y = (window.getSize().y - 2 * padding) / static_cast<float>(max_y - min_y);
+            auto position = [&](double x, double y) {
+                return sf::Vector2f(padding + static_cast<float>(x - min_x) * scale_x + offset.x,
+                                    window.getSize().y - padding - static_cast<float>(y - min_y) * scale_y + offset.y);
+            };
+
+            window.clear(sf::Color::White);
+
+            sf::VertexArray x_axis(sf::Lines, 2);
+            x_axis[0].position = sf::Vector2f(padding + offset.x, window.getSize().y - padding + offset.y);
+            x_axis[1].position = sf::Vector2f(window.getSize().x - padding + offset.x,
+                                              window.getSize().y - padding + offset.y);
+            x_axis[0].color = x_axis[1].color = sf::Color::Black;
+
+            sf::VertexArray y_axis(sf::Lines, 2);
+            y_axis[0].position = sf::Vector2f(padding + offset.x, padding + offset.y);
+            y_axis[1].position = sf::Vector2f(padding + offset.x, window.getSize().y - padding + offset.y);
+            y_axis[0].color = y_axis[1].color = sf::Color::Black;
+
+            window.draw(x_axis);
+            window.draw(y_axis);
+
+            for (int i = 0; !empty && i <= 10; ++i) {
+                double x_value = min_x + (max_x - min_x) * i / 10;
+                double x_label_value = log_x ? std::pow(10.0, x_value) : x_value;
+                sf::Text x_label;
+                x_label.setFont(font);
+                x_label.setString(options.x_tick ? options.x_tick(x_label_value) : plotTick(x_label_value));
+                x_label.setCharacterSize(12);
+                x_label.setFillColor(sf::Color::Black);
+                x_label.setPosition(position(x_value, min_y).x, window.getSize().y - padding + 5 + offset.y);
+                window.draw(x_label);
+
+                double y_value = min_y + (max_y - min_y) * i / 10;
+                sf::Text y_label;
+                y_label.setFont(font);
+                y_label.setString(plotTick(log_y ? std::pow(10.0, y_value) : y_value));
+                y_label.setCharacterSize(12);
+                y_label.setFillColor(sf::Color::Black);
+                y_label.setPosition(padding - 30 + offset.x, position(min_x, y_value).y - 10);
+                window.draw(y_label);
             }
-        }
 
-        window.clear(sf::Color::White);
-
-        sf::VertexArray x_axis(sf::Lines, 2);
-        x_axis[0].position = sf::Vector2f(padding + offset.x, window.getSize().y - padding + offset.y);
-        x_axis[1].position = sf::Vector2f(window.getSize().x - padding + offset.x,
-                                          window.getSize().y - padding + offset.y);
-        x_axis[0].color = x_axis[1].color = sf::Color::Black;
-
-        sf::VertexArray y_axis(sf::Lines, 2);
-        y_axis[0].position = sf::Vector2f(padding + offset.x, padding + offset.y);
-        y_axis[1].position = sf::Vector2f(padding + offset.x, window.getSize().y - padding + offset.y);
-        y_axis[0].color = y_axis[1].color = sf::Color::Black;
-
-        window.draw(x_axis);
-        window.draw(y_axis);
-
-        for (int i = 0; i <= 10; ++i) {
-            float x_value = min_x + (max_x - min_x) * i / 10;
-            float x_pos = padding + (x_value - min_x) * scale_x + offset.x;
-            sf::Text x_label;
-            x_label.setFont(font);
-            x_label.setString(std::to_string(static_cast<int>(x_value)));
-            x_label.setCharacterSize(12);
-            x_label.setFillColor(sf::Color::Black);
-            x_label.setPosition(x_pos, window.getSize().y - padding + 5 + offset.y);
-            window.draw(x_label);
-
-            float y_value = min_y + (max_y - min_y) * i / 10;
-            float y_pos = window.getSize().y - padding - (y_value - min_y) * scale_y + offset.y;
-            sf::Text y_label;
-            y_label.setFont(font);
-            y_label.setString(std::to_string(static_cast<int>(y_value)));
-            y_label.setCharacterSize(12);
-            y_label.setFillColor(sf::Color::Black);
-            y_label.setPosition(padding - 30 + offset.x, y_pos - 10);
-            window.draw(y_label);
-        }
-
-        auto draw_graph = [&](std::vector<Dot> coordinates, sf::Color color) {
-            sf::VertexArray lines(sf::LinesStrip, coordinates.size());
-            for (size_t i = 0; i < coordinates.size(); ++i) {
-                float x = padding + (coordinates[i].x - min_x) * scale_x + offset.x;
-                float y = window.getSize().y - padding - (coordinates[i].y - min_y) * scale_y + offset.y;
-                lines[i].position = sf::Vector2f(x, y);
-                lines[i].color = color;
-
-                sf::CircleShape point(3);
-                point.setFillColor(color);
-                point.setPosition(x - point.getRadius(), y - point.getRadius());
-                window.draw(point);
+            auto draw_graph = [&](const std::vector<Dot> &coordinates, sf::Color color) {
+                sf::VertexArray lines(sf::LinesStrip);
+                for (const Dot &coord: coordinates) {
+                    if (!visible(coord)) {
+                        continue;
+                    }
+                    sf::Vector2f point_position = position(to_x(coord.x), to_y(coord.y));
+                    lines.append(sf::Vertex(point_position, color));
+
+                    if (coord.error > 0) {
+                        double low = coord.y - coord.error;
+                        sf::Vector2f top = position(to_x(coord.x), to_y(coord.y + coord.error));
+                        sf::Vector2f bottom = position(to_x(coord.x), low > 0 || !log_y ? to_y(low) : min_y);
+                        sf::VertexArray bar(sf::Lines, 6);
+                        bar[0].position = top;
+                        bar[1].position = bottom;
+                        bar[2].position = top + sf::Vector2f(-4.f, 0.f);
+                        bar[3].position = top + sf::Vector2f(4.f, 0.f);
+                        bar[4].position = bottom + sf::Vector2f(-4.f, 0.f);
+                        bar[5].position = bottom + sf::Vector2f(4.f, 0.f);
+                        for (size_t i = 0; i < bar.getVertexCount(); ++i) {
+                            bar[i].color = color;
+                        }
+                        window.draw(bar);
+                    }
+
+                    sf::CircleShape point(3);
+                    point.setFillColor(color);
+                    point.setPosition(point_position.x - point.getRadius(), point_position.y - point.getRadius());
+                    window.draw(point);
+                }
+                window.draw(lines);
+            };
+
+            for (const auto &item: series) {
+                draw_graph(item.data, item.color);
             }
-            window.draw(lines);
-        };
+            plotLegend(window, font, series); // legend of plot
+            std::string x_title = options.x_title + (log_x ? " (log)" : "");
+            std::string y_title = options.y_title + (log_y ? " (log)" : "");
+            plotAxes(window, font, padding, x_title, y_title); // axes Oy & Oy
+            plotProgress(window, font, padding, progress);
 
-        draw_graph(coordinates_1, series[0].color);
-        draw_graph(coordinates_2, series[1].color);
-        plotLegend(window, font, series); // legend of plot
-        plotAxes(window, font, padding); // axes Oy & Oy
+            window.display();
+        }
+    }
+}
 
-        window.display();
+void plotSeries(const Sequence<DataSeries> &series, const std::string &x_title, const std::string &y_title,
+                std::string (*x_tick)(double)) {
+    bool empty = true;
+    for (const auto &item: series) {
+        empty = empty && item.data.empty();
     }
+    if (empty) {
+        std::cout << "Nothing to plot." << std::endl;
+        return;
+    }
+
+    PlotOptions options;
+    options.x_title = x_title;
+    options.y_title = y_title;
+    options.x_tick = x_tick;
+    PlotFeed feed(series, 0);
+    feed.finish();
+    plotWindow(feed, options);
+}
+
+void plotLive(const Sequence<DataSeries> &series, const PlotOptions &options, size_t expected_points,
+              const std::function<void(PlotFeed &)> &producer) {
+    PlotFeed feed(series, expected_points);
+    std::string failure;
+    std::thread worker([&feed, &producer, &failure] {
+        try {
+            producer(feed);
+        } catch (const std::exception &error) {
+            failure = error.what();
+            feed.setStatus("Error: " + failure);
+        }
+        feed.finish();
+    });
+    plotWindow(feed, options);
+
+    feed.cancel();
+    PlotProgress progress;
+    feed.snapshot(progress);
+    if (!progress.finished) {
+        std::cout << "Waiting for the current measurement to stop..." << std::endl;
+    }
+    worker.join();
+    if (!failure.empty()) {
+        std::cerr << "Error: " << failure << std::endl;
+    }
+}
+
+std::vector<Dot> percentileDots(const LatencyHistogram &histogram) {
+    const int points_per_decade = 10;
+    const int decade = 1000;
+    std::vector<Dot> dots;
+    int x = 0;
+    for (const auto &[percent, value]: histogram.percentileCurve(points_per_decade)) {
+        if (percent < 100) {
+            x = static_cast<int>(std::lround(-std::log10(1 - percent / 100) * decade));
+        } else {
+            x += decade / points_per_decade;
+        }
+        dots.push_back({x, static_cast<double>(value)});
+    }
+    return dots;
+}
+
+std::string percentileTick(double x) {
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "p%.4g", 100 * (1 - std::pow(10.0, -x / 1000)));
+    return buffer;
+}
+
+// Ряды: для каждой операции - наша структура (series[0]) и std-аналог (series[1]).
+// Шаги размера идут по возрастанию, на каждом шаге - обе структуры, так что кривые растут одновременно
+template<typename TStruct, typename StdStruct>
+void plotInit(int values, Sequence<DataSeries> &series) {
+    const Color own_colors[] = {Color(220, 20, 60), Color(255, 140, 0), Color(199, 21, 133), Color(139, 69, 19)};
+    const Color std_colors[] = {Color::Blue, Color(0, 160, 160), Color(34, 139, 34), Color(75, 0, 130)};
+    Sequence<DataSeries> lines;
+    for (size_t op = 0; op < 4; ++op) {
+        lines.add(DataSeries(series[0].title + " " + plot_operations[op], own_colors[op]));
+        lines.add(DataSeries(series[1].title + " " + plot_operations[op], std_colors[op]));
+    }
+
+    const int step = std::max(1, values / plot_steps);
+    size_t steps = values > 0 ? static_cast<size_t>(values / step) : 0;
+    PlotOptions options;
+    options.y_title = "Time, ns/op";
+    std::cout << "Generating plot data..." << std::endl;
+    plotLive(lines, options, steps * lines.getSize(), [values, step](PlotFeed &feed) {
+        for (int size = step; size <= values; size += step) {
+            feed.setStatus("Size " + std::to_string(size) + " / " + std::to_string(values));
+            auto own = [&feed](size_t op, const Dot &dot) {
+                feed.add(2 * op, dot);
+                return !feed.cancelled();
+            };
+            auto standard = [&feed](size_t op, const Dot &dot) {
+                feed.add(2 * op + 1, dot);
+                return !feed.cancelled();
+            };
+            if (!cppPlotCore<TStruct>(size, own) || !cppPlotCore<StdStruct>(size, standard)) {
+                return;
+            }
+        }
+        feed.setStatus("Plot data is completed");
+    });
 }
 
 template void plotInit<Sequence<int>, std::vector<int>>(int values, Sequence<DataSeries> &series);
@@ -1,12 +1,17 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <atomic>
 #include <chrono>
+#include <functional>
+#include <mutex>
 #include <vector>
 #include <set>
 #include <list>
 #include <unordered_map>
 #include "../include/graph.hpp"
+#include "../include/latency_histogram.hpp"
+#include "../include/sequence.hpp"
 
 
 using namespace std;
@@ -16,11 +21,13 @@ using namespace sf;
 struct Dot {
     int x;
     double y;
+    double error = 0;   // полуширина планки погрешности (стандартное отклонение по повторам), 0 - без планки
 
     Dot &operator=(const Dot &other) {
         if (this != &other) {
             x = other.x;
             y = other.y;
+            error = other.error;
         }
         return *this;
     }
@@ -43,11 +50,75 @@ struct DataSeries {
             : data(data), color(color) {}
 };
 
-std::vector<Dot> cppPlotCore(int values);
+struct PlotOptions {
+    std::string x_title = "Amount of data, counts";
+    std::string y_title = "Time, mls";
+    std::string (*x_tick)(double) = nullptr;   // подпись деления Ox, по умолчанию - число
+    bool log_x = false;                         // логарифмические оси, в окне переключаются клавишами X и Y
+    bool log_y = false;
+};
+
+struct PlotProgress {
+    size_t received = 0;
+    size_t expected = 0;        // 0 - график без фонового замера
+    bool finished = false;
+    std::string status;         // последнее сообщение потока замеров
+};
+
+// Ряды живого графика: поток замеров добавляет точки, окно на каждом кадре берёт копию.
+// Закрытие окна выставляет cancelled(), поток замеров должен проверять его между точками.
+// Поток замеров не пишет в консоль (её использует окно и основной поток): сообщения о ходе замеров
+// передаются через setStatus и показываются в окне
+class PlotFeed {
+private:
+    mutable std::mutex mutex;
+    Sequence<DataSeries> series;
+    PlotProgress progress;
+    std::atomic<bool> cancel_requested;
+
+public:
+    PlotFeed(const Sequence<DataSeries> &series, size_t expected_points);
+
+    void add(size_t index, const Dot &dot);
+
+    void setTitle(size_t index, const std::string &title);
+
+    void setStatus(const std::string &status);
+
+    void finish();
+
+    void cancel();
+
+    [[nodiscard]] bool cancelled() const;
+
+    Sequence<DataSeries> snapshot(PlotProgress &state) const;
+};
 
 void plotLegend(sf::RenderWindow &window, sf::Font &font, const Sequence<DataSeries> &series);
 
-void plotAxes(sf::RenderWindow &window, sf::Font &font, float padding);
+void plotAxes(sf::RenderWindow &window, sf::Font &font, float padding, const std::string &x_title,
+              const std::string &y_title);
+
+// Окно с любым числом уже посчитанных рядов. x_tick переводит значение Ox в подпись деления
+// (по умолчанию - целое число)
+void plotSeries(const Sequence<DataSeries> &series, const std::string &x_title,
+                const std::string &y_title = "Time, mls", std::string (*x_tick)(double) = nullptr);
+
+// Живой график: producer выполняется в фоновом потоке и передаёт точки через PlotFeed, окно сразу
+// их рисует и показывает прогресс (expected_points - сколько точек ожидается всего). После закрытия
+// окна функция ждёт, пока producer заметит cancelled() и завершится; исключение producer печатается
+// уже после этого, из вызывающего потока
+void plotLive(const Sequence<DataSeries> &series, const PlotOptions &options, size_t expected_points,
+              const std::function<void(PlotFeed &)> &producer);
+
+// Кривая "задержка (нс) от процентиля": Ox - число девяток в процентиле, умноженное на 1000
+// (0 - p0, 1000 - p90, 2000 - p99, 3000 - p99.9), последняя точка - максимум
+std::vector<Dot> percentileDots(const LatencyHistogram &histogram);
+
+// Подпись деления оси percentileDots: 2000 -> "p99"
+std::string percentileTick(double x);
 
+// Живой график insert/get/remove/iterate (нс на операцию) для TStruct и StdStruct; названия рядов -
+// из series[0].title и series[1].title
 template<typename TStruct, typename StdStruct>
 void plotInit(int values, Sequence<DataSeries> &series);
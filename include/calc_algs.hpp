@@ -1,24 +1,13 @@
 #pragma once
 
-//sf::Color getColorFromIndex(size_t index) {
-//    static const std::vector<sf::Color> colors = {
-//            sf::Color::Red,
-//            sf::Color::Green,
-//            sf::Color::Blue,
-//            sf::Color::Yellow,
-//            sf::Color::Cyan,
-//            sf::Color::Magenta
-//    };
-//    return colors[index % colors.size()];
-//}
-
-sf::Color getColorFromIndex(size_t index) {
-    sf::Uint8 r = (++index * 123) % 256;
-    sf::Uint8 g = (++index * 456) % 256;
-    sf::Uint8 b = (++index * 789) % 256;
-
-    return sf::Color(r, g, b);
-}
+#include <algorithm>
+#include <climits>
+#include <utility>
+#include <vector>
+#include "graph.hpp"
+#include "hash_set.hpp"
+#include "sorts_algs.hpp"
+
 
 template <typename T>
 std::vector<size_t> greedyColoring(Graph<T> graph) {
@@ -37,8 +26,7 @@ std::vector<size_t> greedyColoring(Graph<T> graph) {
         std::vector<bool> available(vertex_count, true);
 
         const auto& neighbors = graph.getNeighbors(currentVertex);
-        for (size_t j = 0; j < neighbors.getSize(); ++j) {
-            const T& neighbor = neighbors.get(j);
+        for (const T& neighbor : neighbors.view()) {
             if (colors[vertex_index_m[neighbor]] != -1) {
                 available[colors[vertex_index_m[neighbor]]] = false;
             }
@@ -101,13 +89,28 @@ ArraySequence<Edge<T>> kruskal(const Graph<T>& graph) {
     }
 
     ArraySequence<Edge<T>> edges = graph.getEdges();
-    edges.sort();
+    size_t vertex_count = graph.getVertexCount();
+    size_t edge_count = edges.getSize();
+    if (edge_count == 0) {
+        return mst;
+    }
 
-    for (const auto& edge : edges) {
-        if (disjointSet.findSet(edge.vertex1) != disjointSet.findSet(edge.vertex2)) {
-            mst.add(edge);
-            disjointSet.unionSets(edge.vertex1, edge.vertex2);
+    // Рёбра упорядочиваются порциями (частичной сортировкой): для связного графа остов
+    // обычно собирается из малой доли самых лёгких рёбер, и остаток можно не сортировать
+    auto byWeight = [](const Edge<T>& a, const Edge<T>& b) { return a.weight < b.weight; };
+    Edge<T>* data = edges.data();
+    size_t batch = std::max<size_t>(vertex_count * 2, 1024);
+    for (size_t begin = 0; begin < edge_count && mst.getSize() + 1 < vertex_count; batch *= 2) {
+        size_t end = std::min(edge_count, begin + batch);
+        PdqSort<Edge<T>>::partialSortRange(data + begin, data + end, data + edge_count, byWeight);
+        for (size_t i = begin; i < end && mst.getSize() + 1 < vertex_count; ++i) {
+            const Edge<T>& edge = data[i];
+            if (disjointSet.findSet(edge.vertex1) != disjointSet.findSet(edge.vertex2)) {
+                mst.add(edge);
+                disjointSet.unionSets(edge.vertex1, edge.vertex2);
+            }
         }
+        begin = end;
     }
     return mst;
 }
@@ -124,6 +127,7 @@ std::pair<ArraySequence<T>, int> dijkstra(const Graph<T>& graph, const T& start,
         unvisited.add(vertex);
     }
     distances[start] = 0;
+    const ArraySequence<Edge<T>> edges = graph.getEdges();
 
     while (unvisited.size() > 0) {
         T current;
@@ -143,7 +147,7 @@ std::pair<ArraySequence<T>, int> dijkstra(const Graph<T>& graph, const T& start,
         if (current == end) break;
         unvisited.remove(current);
 
-        for (const auto& edge : graph.getEdges()) {
+        for (const Edge<T>& edge : edges.view()) {
             if (edge.vertex1 == current || edge.vertex2 == current) {
                 T neighbor = (edge.vertex1 == current) ? edge.vertex2 : edge.vertex1;
                 int new_dist = distances[current] + edge.weight;
@@ -168,7 +172,7 @@ std::pair<ArraySequence<T>, int> dijkstra(const Graph<T>& graph, const T& start,
 
         ArraySequence<T> reversedPath;
         for (int i = path.getSize() - 1; i >= 0; --i) {
-            reversedPath.add(path.get(i));
+            reversedPath.add(path.uncheckedAt(i));
         }
         return {reversedPath, distances[end]};
     }
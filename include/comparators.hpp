@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <string>
 
 
@@ -28,4 +29,40 @@ inline bool compareStringIncrease(const std::string &p1, const std::string &p2)
 
 inline bool compareStringDecrease(const std::string &p1, const std::string &p2) {
     return p1 > p2;
-}
\ No newline at end of file
+}
+
+// Компараторы для шаблонного пути сортировки: вызываются напрямую и встраиваются компилятором,
+// в отличие от указателей на функции выше
+struct Ascending {
+    template<typename A, typename B>
+    constexpr bool operator()(const A &a, const B &b) const {
+        return a < b;
+    }
+};
+
+struct Descending {
+    template<typename A, typename B>
+    constexpr bool operator()(const A &a, const B &b) const {
+        return b < a;
+    }
+};
+
+inline constexpr Ascending ascending{};
+inline constexpr Descending descending{};
+
+// Сравнение по ключу: projection - функция или указатель на поле (например, &Edge<T>::weight)
+template<typename Projection, typename Order = Ascending>
+struct ByKey {
+    Projection projection;
+    Order order;
+
+    template<typename T>
+    constexpr bool operator()(const T &a, const T &b) const {
+        return order(std::invoke(projection, a), std::invoke(projection, b));
+    }
+};
+
+template<typename Projection, typename Order = Ascending>
+constexpr ByKey<Projection, Order> byKey(Projection projection, Order order = Order()) {
+    return {projection, order};
+}
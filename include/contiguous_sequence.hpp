@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "iterators.hpp"
+#include "sequence_base.hpp"
+#include "span.hpp"
+
+
+// Общая реализация последовательностей с непрерывным буфером (Sequence, ArraySequence):
+// хранение, рост, add/insert/remove/get, span/view и итераторы. Наследник задаёт только
+// начальную ёмкость и свои операции (у ArraySequence - выбор сортировки).
+template<typename Derived, typename T>
+class ContiguousSequence : public SequenceBase<Derived, T> {
+protected:
+    T *elements;
+    size_t capacity;
+    size_t size;
+
+    explicit ContiguousSequence(size_t initialCapacity)
+            : elements(new T[initialCapacity]), capacity(initialCapacity), size(0) {}
+
+    ContiguousSequence(const ContiguousSequence &other)
+            : elements(new T[other.capacity]), capacity(other.capacity), size(other.size) {
+        for (size_t i = 0; i < size; ++i) {
+            elements[i] = other.elements[i];
+        }
+    }
+
+    ContiguousSequence(ContiguousSequence &&other) noexcept
+            : elements(other.elements), capacity(other.capacity), size(other.size) {
+        other.elements = nullptr;
+        other.size = other.capacity = 0;
+    }
+
+    ~ContiguousSequence() {
+        delete[] elements;
+    }
+
+    ContiguousSequence &operator=(const ContiguousSequence &other) {
+        if (this != &other) {
+            ContiguousSequence tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    ContiguousSequence &operator=(ContiguousSequence &&other) noexcept {
+        if (this != &other) {
+            delete[] elements;
+            elements = other.elements;
+            size = other.size;
+            capacity = other.capacity;
+            other.elements = nullptr;
+            other.size = other.capacity = 0;
+        }
+        return *this;
+    }
+
+    void resize() {
+        reserve(capacity ? capacity * 2 : 1);
+    }
+
+public:
+    void add(const T &element) {
+        if (size == capacity) {
+            resize();
+        }
+        elements[size++] = element;
+    }
+
+    void add(T &&element) {
+        if (size == capacity) {
+            resize();
+        }
+        elements[size++] = std::move(element);
+    }
+
+    // Элемент строится из аргументов и переносится в буфер без копирования
+    template<typename... Args>
+    T &emplace(Args &&...args) {
+        T element(std::forward<Args>(args)...);
+        add(std::move(element));
+        return elements[size - 1];
+    }
+
+    void insert(size_t index, const T &element) {
+        insert(index, T(element));
+    }
+
+    // Вставка перед index (index == getSize() - в конец), хвост сдвигается перемещением
+    void insert(size_t index, T &&element) {
+        if (index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        if (size == capacity) {
+            resize();
+        }
+        std::move_backward(elements + index, elements + size, elements + size + 1);
+        elements[index] = std::move(element);
+        ++size;
+    }
+
+    // Пакетное добавление: если длина диапазона известна, буфер расширяется один раз.
+    // Для переноса вместо копирования - std::make_move_iterator.
+    template<typename InputIt>
+    void append(InputIt first, InputIt last) {
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+            reserve(size + static_cast<size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            add(*first);
+        }
+    }
+
+    void reserve(size_t newCapacity) {
+        if (newCapacity <= capacity) {
+            return;
+        }
+        T *newData = new T[newCapacity];
+        for (size_t i = 0; i < size; ++i) {
+            newData[i] = std::move(elements[i]);
+        }
+        delete[] elements;
+        elements = newData;
+        capacity = newCapacity;
+    }
+
+    void remove(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        for (size_t i = index; i < size - 1; ++i) {
+            elements[i] = std::move(elements[i + 1]);
+        }
+        --size;
+    }
+
+    bool contains(const T &element) const {
+        for (size_t i = 0; i < size; ++i) {
+            if (elements[i] == element) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void removeElement(const T &element) {
+        for (size_t i = 0; i < size; ++i) {
+            if (elements[i] == element) {
+                remove(i);
+                return;
+            }
+        }
+        throw std::runtime_error("Element not found");
+    }
+
+    T &get(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return elements[index];
+    }
+
+    const T &get(size_t index) const {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return elements[index];
+    }
+
+    [[nodiscard]] size_t getSize() const {
+        return size;
+    }
+
+    // Непрерывный буфер элементов (для сортировок без get), nullptr - если элементы хранятся не подряд
+    T *contiguousData() {
+        return elements;
+    }
+
+    // Быстрый доступ для внутренних циклов: без виртуального вызова и без проверки границ
+    // (проверка остаётся только в сборке с LAB4_CHECKED_ACCESS)
+    T *data() {
+        return elements;
+    }
+
+    const T *data() const {
+        return elements;
+    }
+
+    T &uncheckedAt(size_t index) {
+        checkIndex(index, size);
+        return elements[index];
+    }
+
+    const T &uncheckedAt(size_t index) const {
+        checkIndex(index, size);
+        return elements[index];
+    }
+
+    Span<T> span() {
+        return Span<T>(elements, size);
+    }
+
+    Span<const T> view() const {
+        return Span<const T>(elements, size);
+    }
+
+    T &operator[](size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return elements[index];
+    }
+
+    const T &operator[](size_t index) const {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return elements[index];
+    }
+
+    bool operator==(const Derived &other) const {
+        const ContiguousSequence &rhs = other;
+        if (size != rhs.size) {
+            return false;
+        }
+        for (size_t i = 0; i < size; ++i) {
+            if (elements[i] != rhs.elements[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    Iterator<T> begin() {
+        return Iterator<T>(elements);
+    }
+
+    Iterator<T> end() {
+        return Iterator<T>(elements + size);
+    }
+
+    ConstIterator<T> begin() const {
+        return ConstIterator<T>(elements);
+    }
+
+    ConstIterator<T> end() const {
+        return ConstIterator<T>(elements + size);
+    }
+
+    ConstIterator<T> cbegin() const {
+        return ConstIterator<T>(elements);
+    }
+
+    ConstIterator<T> cend() const {
+        return ConstIterator<T>(elements + size);
+    }
+};
\ No newline at end of file
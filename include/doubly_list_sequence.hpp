@@ -0,0 +1,386 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "sequence_base.hpp"
+
+
+// Двусвязный вариант ListSequence: кольцо с фиктивным узлом, поэтому вставка и удаление
+// по итератору, а также с обоих концов - O(1); get(index) идёт от ближайшего из концов или кеша.
+template<typename T>
+class DoublyListSequence : public SequenceBase<DoublyListSequence<T>, T> {
+private:
+    struct NodeBase {
+        NodeBase *prev;
+        NodeBase *next;
+    };
+
+    struct Node : NodeBase {
+        T data;
+
+        template<typename... Args>
+        explicit Node(Args &&...args) : NodeBase{nullptr, nullptr}, data(std::forward<Args>(args)...) {}
+    };
+
+    NodeBase sentinel;  // end(): sentinel.next - первый элемент, sentinel.prev - последний
+    size_t size;
+
+    // Кеш последнего узла, найденного по индексу (см. ListSequence): сдвигается только
+    // неконстантными методами, const get() его не меняет
+    NodeBase *cursor;
+    size_t cursor_index;
+
+    void reset() {
+        sentinel.prev = sentinel.next = &sentinel;
+        size = 0;
+        cursor = nullptr;
+    }
+
+    void takeNodes(DoublyListSequence &other) {
+        if (!other.size) {
+            reset();
+            return;
+        }
+        sentinel.next = other.sentinel.next;
+        sentinel.prev = other.sentinel.prev;
+        sentinel.next->prev = &sentinel;
+        sentinel.prev->next = &sentinel;
+        size = other.size;
+        cursor = nullptr;
+        other.reset();
+    }
+
+    NodeBase *findNode(size_t index) const {
+        NodeBase *current;
+        size_t position;
+        size_t from_end = size - 1 - index;
+        if (cursor && (cursor_index > index ? cursor_index - index : index - cursor_index) < std::min(index, from_end)) {
+            current = cursor;
+            position = cursor_index;
+        } else if (index <= from_end) {
+            current = sentinel.next;
+            position = 0;
+        } else {
+            current = sentinel.prev;
+            position = size - 1;
+        }
+        for (; position < index; ++position) {
+            current = current->next;
+        }
+        for (; position > index; --position) {
+            current = current->prev;
+        }
+        return current;
+    }
+
+    NodeBase *nodeAt(size_t index) {
+        NodeBase *current = findNode(index);
+        cursor = current;
+        cursor_index = index;
+        return current;
+    }
+
+    void linkBefore(NodeBase *position, Node *node) {
+        node->next = position;
+        node->prev = position->prev;
+        position->prev->next = node;
+        position->prev = node;
+        ++size;
+        cursor = nullptr;
+    }
+
+    NodeBase *unlink(NodeBase *node) {
+        NodeBase *next = node->next;
+        node->prev->next = next;
+        next->prev = node->prev;
+        delete static_cast<Node *>(node);
+        --size;
+        cursor = nullptr;
+        return next;
+    }
+
+public:
+    DoublyListSequence() : sentinel{&sentinel, &sentinel}, size(0), cursor(nullptr), cursor_index(0) {}
+
+    DoublyListSequence(const DoublyListSequence &other) : DoublyListSequence() {
+        for (const T &element : other) {
+            add(element);
+        }
+    }
+
+    DoublyListSequence(DoublyListSequence &&other) noexcept : DoublyListSequence() {
+        takeNodes(other);
+    }
+
+    ~DoublyListSequence() {
+        clear();
+    }
+
+    void add(const T &element) {
+        emplace(element);
+    }
+
+    void add(T &&element) {
+        emplace(std::move(element));
+    }
+
+    template<typename... Args>
+    T &emplace(Args &&...args) {
+        Node *newNode = new Node(std::forward<Args>(args)...);
+        linkBefore(&sentinel, newNode);
+        return newNode->data;
+    }
+
+    void insert(size_t index, const T &element) {
+        if (index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        linkBefore(index == size ? &sentinel : nodeAt(index), new Node(element));
+    }
+
+    void insert(size_t index, T &&element) {
+        if (index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        linkBefore(index == size ? &sentinel : nodeAt(index), new Node(std::move(element)));
+    }
+
+    template<typename InputIt>
+    void append(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            emplace(*first);
+        }
+    }
+
+    void remove(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        unlink(nodeAt(index));
+    }
+
+    T &get(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return static_cast<Node *>(nodeAt(index))->data;
+    }
+
+    const T &get(size_t index) const {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return static_cast<const Node *>(findNode(index))->data;
+    }
+
+    [[nodiscard]] size_t getSize() const {
+        return size;
+    }
+
+    // Элементы списка не лежат подряд
+    T *contiguousData() {
+        return nullptr;
+    }
+
+    void clear() {
+        while (size) {
+            unlink(sentinel.next);
+        }
+    }
+
+    DoublyListSequence &operator=(const DoublyListSequence &other) {
+        if (this != &other) {
+            clear();
+            for (const T &element : other) {
+                add(element);
+            }
+        }
+        return *this;
+    }
+
+    DoublyListSequence &operator=(DoublyListSequence &&other) noexcept {
+        if (this != &other) {
+            clear();
+            takeNodes(other);
+        }
+        return *this;
+    }
+
+    bool operator==(const DoublyListSequence &other) const {
+        if (size != other.size) {
+            return false;
+        }
+        auto it = other.begin();
+        for (const T &element : *this) {
+            if (element != *it++) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename NodePointer, typename Reference>
+    class BasicIterator {
+    private:
+        NodePointer current;
+
+        friend class DoublyListSequence;
+
+        template<typename, typename>
+        friend class BasicIterator;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::remove_reference_t<Reference> *;
+        using reference = Reference;
+
+        explicit BasicIterator(NodePointer node) : current(node) {}
+
+        // ListIterator -> ConstListIterator
+        template<typename OtherPointer, typename OtherReference>
+        BasicIterator(const BasicIterator<OtherPointer, OtherReference> &other) : current(other.current) {}
+
+        reference operator*() const {
+            return static_cast<std::conditional_t<std::is_const_v<std::remove_reference_t<Reference>>,
+                    const Node *, Node *>>(current)->data;
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        BasicIterator &operator++() {
+            current = current->next;
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator temp = *this;
+            current = current->next;
+            return temp;
+        }
+
+        BasicIterator &operator--() {
+            current = current->prev;
+            return *this;
+        }
+
+        BasicIterator operator--(int) {
+            BasicIterator temp = *this;
+            current = current->prev;
+            return temp;
+        }
+
+        bool operator==(const BasicIterator &other) const {
+            return current == other.current;
+        }
+
+        bool operator!=(const BasicIterator &other) const {
+            return current != other.current;
+        }
+    };
+
+    using ListIterator = BasicIterator<NodeBase *, T &>;
+    using ConstListIterator = BasicIterator<const NodeBase *, const T &>;
+
+    ListIterator begin() {
+        return ListIterator(sentinel.next);
+    }
+
+    ListIterator end() {
+        return ListIterator(&sentinel);
+    }
+
+    ConstListIterator begin() const {
+        return ConstListIterator(sentinel.next);
+    }
+
+    ConstListIterator end() const {
+        return ConstListIterator(&sentinel);
+    }
+
+    ConstListIterator cbegin() const {
+        return begin();
+    }
+
+    ConstListIterator cend() const {
+        return end();
+    }
+
+    // Операции по позиции за O(1)
+
+    template<typename... Args>
+    ListIterator emplace(ListIterator position, Args &&...args) {
+        Node *newNode = new Node(std::forward<Args>(args)...);
+        linkBefore(position.current, newNode);
+        return ListIterator(newNode);
+    }
+
+    ListIterator insert(ListIterator position, const T &element) {
+        return emplace(position, element);
+    }
+
+    ListIterator insert(ListIterator position, T &&element) {
+        return emplace(position, std::move(element));
+    }
+
+    // Удаляет элемент в позиции; возвращает итератор на следующий
+    ListIterator erase(ListIterator position) {
+        if (position.current == &sentinel) {
+            throw std::out_of_range("Cannot erase end()");
+        }
+        return ListIterator(unlink(position.current));
+    }
+
+    void pushFront(const T &element) {
+        emplace(begin(), element);
+    }
+
+    void pushFront(T &&element) {
+        emplace(begin(), std::move(element));
+    }
+
+    void popFront() {
+        if (!size) {
+            throw std::out_of_range("List is empty");
+        }
+        unlink(sentinel.next);
+    }
+
+    void popBack() {
+        if (!size) {
+            throw std::out_of_range("List is empty");
+        }
+        unlink(sentinel.prev);
+    }
+
+    // Переносит все узлы other перед position без копирования элементов; other становится пустым
+    void splice(ListIterator position, DoublyListSequence &other) {
+        if (&other == this) {
+            throw std::invalid_argument("Cannot splice a list into itself");
+        }
+        if (!other.size) {
+            return;
+        }
+        NodeBase *first = other.sentinel.next;
+        NodeBase *last = other.sentinel.prev;
+        NodeBase *next = position.current;
+        first->prev = next->prev;
+        next->prev->next = first;
+        last->next = next;
+        next->prev = last;
+        size += other.size;
+        cursor = nullptr;
+        other.reset();
+    }
+
+    void splice(ListIterator position, DoublyListSequence &&other) {
+        splice(position, other);
+    }
+};
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <stdexcept>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
 #include "hash_set.hpp"
 
 
@@ -29,6 +33,16 @@ public:
     }
 };
 
+// Хеш неориентированного ребра для пакетной вставки (ключ упорядочен: min, max)
+template <typename T>
+struct EdgeKeyHash {
+    std::size_t operator()(const std::pair<T, T>& p) const {
+        std::size_t hash1 = std::hash<T>{}(p.first);
+        std::size_t hash2 = std::hash<T>{}(p.second);
+        return hash1 ^ (hash2 + 0x9E3779B97F4A7C15ULL + (hash1 << 6) + (hash1 >> 2));
+    }
+};
+
 template<typename T>
 class Graph {
 private:
@@ -92,6 +106,36 @@ public:
         edges.add(Edge<T>{vertex1, vertex2, weight});
     }
 
+    // Пакетное добавление рёбер из любого диапазона Edge<T>.
+    // Дубликаты ищутся по хеш-индексу, а не линейным проходом по edges, как в addEdge.
+    template<typename Range>
+    void addEdges(const Range &range) {
+        std::unordered_map<std::pair<T, T>, size_t, EdgeKeyHash<T>> index;
+        index.reserve(edges.getSize());
+        for (size_t i = 0; i < edges.getSize(); ++i) {
+            const Edge<T>& edge = edges.uncheckedAt(i);
+            index.emplace(edgeKey(edge.vertex1, edge.vertex2), i);
+        }
+
+        for (const auto& edge : range) {
+            if (!hasVertex(edge.vertex1) || !hasVertex(edge.vertex2)) {
+                throw std::runtime_error("Both vertices must exist in the graph before adding an edge");
+            }
+
+            auto inserted = index.emplace(edgeKey(edge.vertex1, edge.vertex2), edges.getSize());
+            if (!inserted.second) {
+                edges.uncheckedAt(inserted.first->second).weight = edge.weight;
+                continue;
+            }
+
+            adjacency_list.get(edge.vertex1).add(edge.vertex2);
+            if (edge.vertex1 != edge.vertex2) {
+                adjacency_list.get(edge.vertex2).add(edge.vertex1);
+            }
+            edges.add(Edge<T>{edge.vertex1, edge.vertex2, edge.weight});
+        }
+    }
+
     bool hasVertex(const T &vertex) const {
         return adjacency_list.contains(vertex);
     }
@@ -136,8 +180,7 @@ public:
         }
 
         ArraySequence<T> neighbors = adjacency_list.get(vertex);
-        for (size_t i = 0; i < neighbors.getSize(); ++i) {
-            const T& adjacentVertex = neighbors.get(i);
+        for (const T& adjacentVertex : neighbors.view()) {
             ArraySequence<T>& adj_neighbors = adjacency_list.get(adjacentVertex);
             adj_neighbors.removeElement(vertex);
         }
@@ -163,8 +206,7 @@ public:
         for (const auto& pair : adjacency_list) {
             const T& vertex = pair.first;
             const ArraySequence<T>& neighbors = pair.second;
-            for (size_t i = 0; i < neighbors.getSize(); ++i) {
-                const T& neighbor = neighbors.get(i);
+            for (const T& neighbor : neighbors.view()) {
                 if (vertex < neighbor) {
                     edges.add(std::make_pair(vertex, neighbor));
                 }
@@ -180,4 +222,46 @@ public:
     ArraySequence<Edge<T>> getEdges() const {
         return edges;
     }
-};
\ No newline at end of file
+
+private:
+    static std::pair<T, T> edgeKey(const T &vertex1, const T &vertex2) {
+        return vertex2 < vertex1 ? std::make_pair(vertex2, vertex1) : std::make_pair(vertex1, vertex2);
+    }
+};
+
+// Ребро между вершинами, заданными индексами во внешнем массиве вершин.
+// Так рёбра производят генераторы и загрузчики, прежде чем строить граф.
+struct IndexedEdge {
+    uint32_t from;
+    uint32_t to;
+    int weight;
+};
+
+using IndexedEdgeChunks = std::vector<std::vector<IndexedEdge>>;
+
+// Пакетная сборка графа: вершины добавляются один раз, рёбра - одним вызовом addEdges
+template<typename T>
+Graph<T> buildGraph(const std::vector<T> &vertices, const IndexedEdgeChunks &chunks) {
+    size_t total = 0;
+    for (const auto &chunk: chunks) {
+        total += chunk.size();
+    }
+
+    std::vector<Edge<T>> edges;
+    edges.reserve(total);
+    for (const auto &chunk: chunks) {
+        for (const auto &edge: chunk) {
+            if (edge.from >= vertices.size() || edge.to >= vertices.size()) {
+                throw std::runtime_error("Edge refers to a missing vertex");
+            }
+            edges.emplace_back(vertices[edge.from], vertices[edge.to], edge.weight);
+        }
+    }
+
+    Graph<T> graph;
+    for (const auto &vertex: vertices) {
+        graph.addVertex(vertex);
+    }
+    graph.addEdges(edges);
+    return graph;
+}
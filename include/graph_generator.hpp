@@ -1,11 +1,38 @@
 #pragma once
 
 #include "graph.hpp"
-#include <random>
+#include "parallel.hpp"
+#include "random.hpp"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
 
 
-std::random_device rd;
-std::mt19937 gen(rd());
+// Параметры генерации: зерно, движок для последовательных генераторов и число потоков.
+// Один и тот же контекст всегда даёт один и тот же граф.
+// Параллельные генераторы используют счётчиковые потоки CounterRng от того же зерна,
+// поэтому их результат не зависит ни от движка, ни от числа потоков.
+struct GeneratorContext {
+    uint64_t seed;
+    RngEngine engine;
+    unsigned threads;
+
+    explicit GeneratorContext(uint64_t seed, RngEngine engine = RngEngine::Xoshiro256, unsigned threads = 0)
+            : seed(seed), engine(engine), threads(threads) {}
+
+    RandomEngine makeEngine() const {
+        return RandomEngine(engine, seed);
+    }
+};
+
+constexpr size_t generator_chunk_size = 4096; // Рёбер (или ячеек решётки) на задачу потока
+constexpr size_t generator_row_chunk = 256;   // Строк матрицы смежности на задачу потока
+
+inline size_t chunkCount(size_t units, size_t per_chunk) {
+    return units / per_chunk + (units % per_chunk != 0);
+}
 
 template<typename T>
 T generateUniqueVertex(int index) {
@@ -18,8 +45,7 @@ T generateUniqueVertex(int index) {
     }
 }
 
-template<typename T>
-Graph<T> generateChainGraph(int numVertices, int minWeight, int maxWeight) {
+inline void validateGeneratorArgs(int numVertices, int minWeight, int maxWeight) {
     if (numVertices <= 0) {
         throw std::invalid_argument("Number of vertices must be positive");
     }
@@ -27,67 +53,204 @@ Graph<T> generateChainGraph(int numVertices, int minWeight, int maxWeight) {
     if (minWeight > maxWeight) {
         throw std::invalid_argument("Minimum weight cannot be greater than maximum weight");
     }
+}
 
-    Graph<T> graph;
-    std::uniform_int_distribution<> dist(minWeight, maxWeight);
-
-    for (int i = 0; i < numVertices; ++i) {
-        graph.addVertex(generateUniqueVertex<T>(i));
+template<typename T>
+Graph<T> buildGeneratedGraph(size_t numVertices, const IndexedEdgeChunks &chunks) {
+    std::vector<T> names;
+    names.reserve(numVertices);
+    for (size_t i = 0; i < numVertices; ++i) {
+        names.push_back(generateUniqueVertex<T>(static_cast<int>(i)));
     }
+    return buildGraph(names, chunks);
+}
 
-    for (int i = 0; i < numVertices - 1; ++i) {
-        int weight = dist(gen);
-        graph.addEdge(generateUniqueVertex<T>(i), generateUniqueVertex<T>(i + 1), weight);
+template<typename T>
+Graph<T> generateChainGraph(int numVertices, int minWeight, int maxWeight, const GeneratorContext &ctx) {
+    validateGeneratorArgs(numVertices, minWeight, maxWeight);
+
+    RandomEngine rng = ctx.makeEngine();
+    IndexedEdgeChunks chunks(1);
+    for (size_t i = 0; i + 1 < static_cast<size_t>(numVertices); ++i) {
+        chunks[0].push_back({uint32_t(i), uint32_t(i + 1), rng.uniformInt(minWeight, maxWeight)});
     }
-    return graph;
+    return buildGeneratedGraph<T>(numVertices, chunks);
 }
 
 template<typename T>
-Graph<T> generateCycleGraph(int numVertices, int minWeight, int maxWeight) {
-    if (numVertices <= 0) {
-        throw std::invalid_argument("Number of vertices must be positive");
-    }
+Graph<T> generateCycleGraph(int numVertices, int minWeight, int maxWeight, const GeneratorContext &ctx) {
+    validateGeneratorArgs(numVertices, minWeight, maxWeight);
 
-    if (minWeight > maxWeight) {
-        throw std::invalid_argument("Minimum weight cannot be greater than maximum weight");
+    RandomEngine rng = ctx.makeEngine();
+    IndexedEdgeChunks chunks(1);
+    for (size_t i = 0; i < static_cast<size_t>(numVertices); ++i) {
+        chunks[0].push_back({uint32_t(i), uint32_t((i + 1) % numVertices), rng.uniformInt(minWeight, maxWeight)});
     }
+    return buildGeneratedGraph<T>(numVertices, chunks);
+}
+
+template<typename T>
+Graph<T> generateCompleteGraph(int numVertices, int minWeight, int maxWeight, const GeneratorContext &ctx) {
+    validateGeneratorArgs(numVertices, minWeight, maxWeight);
 
-    Graph<T> graph;
-    std::uniform_int_distribution<> dist(minWeight, maxWeight);
+    RandomEngine rng = ctx.makeEngine();
+    IndexedEdgeChunks chunks(1);
+    for (size_t i = 0; i < static_cast<size_t>(numVertices); ++i) {
+        for (size_t j = i + 1; j < static_cast<size_t>(numVertices); ++j) {
+            chunks[0].push_back({uint32_t(i), uint32_t(j), rng.uniformInt(minWeight, maxWeight)});
+        }
+    }
+    return buildGeneratedGraph<T>(numVertices, chunks);
+}
 
-    for (int i = 0; i < numVertices; ++i) {
-        graph.addVertex(generateUniqueVertex<T>(i));
+// Эрдёш-Реньи G(n, p): пропуск неребер геометрическим распределением (Batagelj-Brandes),
+// строка v перебирает пары (v, w), w < v, со своим потоком случайных чисел
+template<typename T>
+Graph<T> generateRandomGraph(int numVertices, double probability, int minWeight, int maxWeight,
+                             const GeneratorContext &ctx) {
+    validateGeneratorArgs(numVertices, minWeight, maxWeight);
+    if (probability < 0.0 || probability > 1.0) {
+        throw std::invalid_argument("Probability must be in [0, 1]");
     }
 
-    for (int i = 0; i < numVertices; ++i) {
-        int weight = dist(gen);
-        graph.addEdge(generateUniqueVertex<T>(i), generateUniqueVertex<T>((i + 1) % numVertices), weight);
+    size_t rows = numVertices;
+    IndexedEdgeChunks chunks(chunkCount(rows, generator_row_chunk));
+    if (probability > 0.0) {
+        double log_q = std::log(1.0 - probability);
+        parallelFor(chunks.size(), ctx.threads, [&](size_t chunk) {
+            size_t last = std::min(rows, (chunk + 1) * generator_row_chunk);
+            for (size_t v = chunk * generator_row_chunk; v < last; ++v) {
+                CounterRng rng(ctx.seed, v);
+                double w = -1.0;
+                while (true) {
+                    w += 1.0 + std::floor(std::log(1.0 - rng.uniformReal()) / log_q);
+                    if (w >= static_cast<double>(v)) {
+                        break;
+                    }
+                    chunks[chunk].push_back({uint32_t(v), uint32_t(w), rng.uniformInt(minWeight, maxWeight)});
+                }
+            }
+        });
     }
-    return graph;
+    return buildGeneratedGraph<T>(rows, chunks);
 }
 
+// R-MAT (Kronecker): каждое ребро спускается по квадрантам матрицы смежности
+// с вероятностями a, b, c, d = 1 - a - b - c. Петли и вершины вне диапазона перегенерируются.
 template<typename T>
-Graph<T> generateCompleteGraph(int numVertices, int minWeight, int maxWeight) {
-    if (numVertices <= 0) {
-        throw std::invalid_argument("Number of vertices must be positive");
+Graph<T> generateRMatGraph(int numVertices, size_t numEdges, int minWeight, int maxWeight,
+                           const GeneratorContext &ctx,
+                           double a = 0.57, double b = 0.19, double c = 0.19) {
+    validateGeneratorArgs(numVertices, minWeight, maxWeight);
+    if (numVertices < 2) {
+        throw std::invalid_argument("R-MAT graph needs at least two vertices");
+    }
+    if (a < 0.0 || b < 0.0 || c < 0.0 || a + b + c > 1.0) {
+        throw std::invalid_argument("R-MAT probabilities must be non-negative and sum to at most 1");
+    }
+    // Иначе (chunk + 1) * generator_chunk_size переполняется и граф молча получается пустым
+    // (так выглядит, например, отрицательное число, приведённое к size_t)
+    if (numEdges > std::numeric_limits<size_t>::max() - generator_chunk_size) {
+        throw std::invalid_argument("R-MAT edge count is too large");
     }
 
-    if (minWeight > maxWeight) {
-        throw std::invalid_argument("Minimum weight cannot be greater than maximum weight");
+    int scale = 0;
+    while ((size_t(1) << scale) < static_cast<size_t>(numVertices)) {
+        ++scale;
     }
 
-    Graph<T> graph;
-    std::uniform_int_distribution<> dist(minWeight, maxWeight);
+    IndexedEdgeChunks chunks(chunkCount(numEdges, generator_chunk_size));
+    parallelFor(chunks.size(), ctx.threads, [&](size_t chunk) {
+        size_t last = std::min(numEdges, (chunk + 1) * generator_chunk_size);
+        chunks[chunk].reserve(last - chunk * generator_chunk_size);
+        for (size_t e = chunk * generator_chunk_size; e < last; ++e) {
+            CounterRng rng(ctx.seed, e);
+            size_t from, to;
+            do {
+                from = to = 0;
+                for (int level = 0; level < scale; ++level) {
+                    double r = rng.uniformReal();
+                    size_t row = (r >= a + b) ? 1 : 0;
+                    size_t col = (r >= a && r < a + b) || r >= a + b + c ? 1 : 0;
+                    from = (from << 1) | row;
+                    to = (to << 1) | col;
+                }
+            } while (from == to || from >= static_cast<size_t>(numVertices) ||
+                     to >= static_cast<size_t>(numVertices));
+            chunks[chunk].push_back({uint32_t(from), uint32_t(to), rng.uniformInt(minWeight, maxWeight)});
+        }
+    });
+    return buildGeneratedGraph<T>(numVertices, chunks);
+}
 
-    for (int i = 0; i < numVertices; ++i) {
-        graph.addVertex(generateUniqueVertex<T>(i));
+// Барабаши-Альберт по схеме Sanders-Schulz: ребро e = v * m + k выбирает позицию r в
+// массиве концов уже созданных рёбер. Чётная позиция - источник ребра r / 2 (известен сразу),
+// нечётная - цель более раннего ребра, которая вычисляется тем же способом.
+// Случайный выбор ребра зависит только от (seed, e), поэтому все рёбра строятся независимо.
+template<typename T>
+Graph<T> generateBarabasiAlbertGraph(int numVertices, int edgesPerVertex, int minWeight, int maxWeight,
+                                     const GeneratorContext &ctx) {
+    validateGeneratorArgs(numVertices, minWeight, maxWeight);
+    if (edgesPerVertex <= 0) {
+        throw std::invalid_argument("Number of edges per vertex must be positive");
     }
 
-    for (int i = 0; i < numVertices; ++i) {
-        for (int j = i + 1; j < numVertices; ++j) {
-            int weight = dist(gen);
-            graph.addEdge(generateUniqueVertex<T>(i), generateUniqueVertex<T>(j), weight);
+    size_t m = edgesPerVertex;
+    size_t numEdges = static_cast<size_t>(numVertices) * m;
+    auto target = [&](size_t e) {
+        while (true) {
+            CounterRng rng(ctx.seed, e);
+            uint64_t r = rng.uniformIndex(2 * e + 1);
+            if (r % 2 == 0) {
+                return (r / 2) / m;
+            }
+            e = (r - 1) / 2;
         }
+    };
+
+    IndexedEdgeChunks chunks(chunkCount(numEdges, generator_chunk_size));
+    parallelFor(chunks.size(), ctx.threads, [&](size_t chunk) {
+        size_t last = std::min(numEdges, (chunk + 1) * generator_chunk_size);
+        for (size_t e = chunk * generator_chunk_size; e < last; ++e) {
+            size_t to = target(e);
+            if (to == e / m) {
+                continue;
+            }
+            CounterRng rng(ctx.seed, e);
+            rng.uniformIndex(2 * e + 1);
+            chunks[chunk].push_back({uint32_t(e / m), uint32_t(to), rng.uniformInt(minWeight, maxWeight)});
+        }
+    });
+    return buildGeneratedGraph<T>(numVertices, chunks);
+}
+
+// Решётка rows x cols: каждая вершина соединена с правым и нижним соседом
+template<typename T>
+Graph<T> generateGridGraph(int rows, int cols, int minWeight, int maxWeight,
+                           const GeneratorContext &ctx) {
+    validateGeneratorArgs(rows, minWeight, maxWeight);
+    if (cols <= 0) {
+        throw std::invalid_argument("Grid dimensions must be positive");
     }
-    return graph;
-}
\ No newline at end of file
+
+    size_t height = rows;
+    size_t width = cols;
+    size_t rows_per_chunk = std::max<size_t>(1, generator_chunk_size / width);
+    IndexedEdgeChunks chunks(chunkCount(height, rows_per_chunk));
+    parallelFor(chunks.size(), ctx.threads, [&](size_t chunk) {
+        size_t last = std::min(height, (chunk + 1) * rows_per_chunk);
+        for (size_t r = chunk * rows_per_chunk; r < last; ++r) {
+            CounterRng rng(ctx.seed, r);
+            for (size_t c = 0; c < width; ++c) {
+                size_t v = r * width + c;
+                if (c + 1 < width) {
+                    chunks[chunk].push_back({uint32_t(v), uint32_t(v + 1), rng.uniformInt(minWeight, maxWeight)});
+                }
+                if (r + 1 < height) {
+                    chunks[chunk].push_back({uint32_t(v), uint32_t(v + width), rng.uniformInt(minWeight, maxWeight)});
+                }
+            }
+        }
+    });
+    return buildGeneratedGraph<T>(height * width, chunks);
+}
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "graph.hpp"
+#include "mapped_file.hpp"
+#include "span.hpp"
+
+
+template<typename T>
+std::string vertexToString(const T &vertex) {
+    if constexpr (std::is_integral_v<T>) {
+        return std::to_string(vertex);
+    } else {
+        return vertex;
+    }
+}
+
+template<typename T>
+T vertexFromString(std::string_view name) {
+    if constexpr (std::is_integral_v<T>) {
+        T value{};
+        auto result = std::from_chars(name.data(), name.data() + name.size(), value);
+        if (result.ec != std::errc() || result.ptr != name.data() + name.size()) {
+            throw std::runtime_error("Vertex is not an integer: " + std::string(name));
+        }
+        return value;
+    } else {
+        return T(name);
+    }
+}
+
+// Бинарный формат графа (версия 1), все секции выровнены на 8 байт:
+//   GraphFileHeader
+//   uint64 name_offsets[V + 1] - границы имён вершин в блоке names
+//   char   names[names_size]   - имена вершин подряд, без разделителей
+//   uint64 row_offsets[V + 1]  - CSR: соседи вершины v лежат в [row_offsets[v], row_offsets[v + 1])
+//   uint32 targets[entries]    - индексы соседей
+//   int32  weights[entries]    - веса соответствующих рёбер
+// Неориентированное ребро хранится в обеих строках, петля - один раз.
+constexpr char graph_file_magic[4] = {'L', '4', 'G', 'R'};
+constexpr uint32_t graph_file_version = 1;
+constexpr uint32_t graph_file_endian_tag = 0x01020304;
+
+enum class VertexKind : uint32_t {
+    Integer = 0,
+    String = 1
+};
+
+struct GraphFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t endian_tag;
+    VertexKind vertex_kind;
+    uint64_t vertex_count;
+    uint64_t edge_count;
+    uint64_t entry_count;
+    uint64_t names_size;
+    uint64_t name_offsets_pos;
+    uint64_t names_pos;
+    uint64_t row_offsets_pos;
+    uint64_t targets_pos;
+    uint64_t weights_pos;
+    uint64_t file_size;
+};
+
+inline uint64_t alignTo8(uint64_t pos) {
+    return (pos + 7) & ~uint64_t(7);
+}
+
+template<typename T>
+void saveGraphBinary(const Graph<T> &graph, const std::string &path) {
+    HashTable<T, ArraySequence<T>> adjacency = graph.getAdjacencyList();
+    ArraySequence<Edge<T>> edges = graph.getEdges();
+    // Индексы соседей в файле 32-битные
+    if (adjacency.size() > UINT32_MAX) {
+        throw std::runtime_error("Graph is too large for the binary format: " + std::to_string(adjacency.size()) +
+                                 " vertices");
+    }
+
+    std::unordered_map<T, uint32_t> index;
+    std::vector<uint64_t> name_offsets(1, 0);
+    std::string names;
+    for (const auto &pair: adjacency) {
+        index.emplace(pair.first, static_cast<uint32_t>(index.size()));
+        names += vertexToString(pair.first);
+        name_offsets.push_back(names.size());
+    }
+
+    size_t vertex_count = index.size();
+    std::vector<uint64_t> row_offsets(vertex_count + 1, 0);
+    for (const auto &edge: edges) {
+        uint32_t from = index.at(edge.vertex1);
+        uint32_t to = index.at(edge.vertex2);
+        ++row_offsets[from + 1];
+        if (from != to) {
+            ++row_offsets[to + 1];
+        }
+    }
+    for (size_t v = 0; v < vertex_count; ++v) {
+        row_offsets[v + 1] += row_offsets[v];
+    }
+
+    std::vector<uint32_t> targets(row_offsets[vertex_count]);
+    std::vector<int32_t> weights(row_offsets[vertex_count]);
+    std::vector<uint64_t> fill(row_offsets.begin(), row_offsets.end() - 1);
+    for (const auto &edge: edges) {
+        uint32_t from = index.at(edge.vertex1);
+        uint32_t to = index.at(edge.vertex2);
+        targets[fill[from]] = to;
+        weights[fill[from]++] = edge.weight;
+        if (from != to) {
+            targets[fill[to]] = from;
+            weights[fill[to]++] = edge.weight;
+        }
+    }
+
+    GraphFileHeader header{};
+    std::memcpy(header.magic, graph_file_magic, sizeof(header.magic));
+    header.version = graph_file_version;
+    header.endian_tag = graph_file_endian_tag;
+    header.vertex_kind = std::is_integral_v<T> ? VertexKind::Integer : VertexKind::String;
+    header.vertex_count = vertex_count;
+    header.edge_count = edges.getSize();
+    header.entry_count = targets.size();
+    header.names_size = names.size();
+    header.name_offsets_pos = alignTo8(sizeof(GraphFileHeader));
+    header.names_pos = header.name_offsets_pos + name_offsets.size() * sizeof(uint64_t);
+    header.row_offsets_pos = alignTo8(header.names_pos + names.size());
+    header.targets_pos = header.row_offsets_pos + row_offsets.size() * sizeof(uint64_t);
+    header.weights_pos = alignTo8(header.targets_pos + targets.size() * sizeof(uint32_t));
+    header.file_size = header.weights_pos + weights.size() * sizeof(int32_t);
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open file for writing: " + path);
+    }
+    auto write_at = [&out](uint64_t pos, const void *bytes, size_t count) {
+        static const char padding[8] = {};
+        out.write(padding, static_cast<std::streamsize>(pos - static_cast<uint64_t>(out.tellp())));
+        out.write(static_cast<const char *>(bytes), static_cast<std::streamsize>(count));
+    };
+    write_at(0, &header, sizeof(header));
+    write_at(header.name_offsets_pos, name_offsets.data(), name_offsets.size() * sizeof(uint64_t));
+    write_at(header.names_pos, names.data(), names.size());
+    write_at(header.row_offsets_pos, row_offsets.data(), row_offsets.size() * sizeof(uint64_t));
+    write_at(header.targets_pos, targets.data(), targets.size() * sizeof(uint32_t));
+    write_at(header.weights_pos, weights.data(), weights.size() * sizeof(int32_t));
+    if (!out) {
+        throw std::runtime_error("Failed to write graph file: " + path);
+    }
+}
+
+// Граф, открытый из бинарного файла через mmap: конструктор за O(1) проверяет только заголовок,
+// границы секций и последние смещения, без разбора и копирования данных. Представление CSR доступно
+// только для чтения; vertexName/neighbors/weights доверяют смещениям и индексам соседей, поэтому
+// для файла из недоверенного источника сначала нужен validate() - полный проход O(V + E), который
+// читает все смещения и весь массив targets. toGraph() вызывает его сам.
+class MappedGraph {
+private:
+    MappedFile file;
+    const GraphFileHeader *header;
+
+    template<typename U>
+    const U *section(uint64_t pos) const {
+        return reinterpret_cast<const U *>(file.data() + pos);
+    }
+
+    void checkSection(uint64_t pos, uint64_t count, uint64_t item_size) const {
+        if (pos % 8 != 0 || pos > file.size() || count > (file.size() - pos) / item_size) {
+            throw std::runtime_error("Corrupted graph file: section out of bounds");
+        }
+    }
+
+    // Границы [offsets[v], offsets[v + 1]) должны идти от 0 до end без убывания
+    void checkOffsets(uint64_t pos) const {
+        const uint64_t *offsets = section<uint64_t>(pos);
+        if (offsets[0] != 0) {
+            throw std::runtime_error("Corrupted graph file: inconsistent offsets");
+        }
+        for (uint64_t v = 0; v < header->vertex_count; ++v) {
+            if (offsets[v] > offsets[v + 1]) {
+                throw std::runtime_error("Corrupted graph file: inconsistent offsets");
+            }
+        }
+    }
+
+public:
+    explicit MappedGraph(const std::string &path) : file(path), header(nullptr) {
+        if (file.size() < sizeof(GraphFileHeader)) {
+            throw std::runtime_error("Not a graph file: " + path);
+        }
+        header = section<GraphFileHeader>(0);
+        if (std::memcmp(header->magic, graph_file_magic, sizeof(graph_file_magic)) != 0) {
+            throw std::runtime_error("Not a graph file: " + path);
+        }
+        if (header->endian_tag != graph_file_endian_tag) {
+            throw std::runtime_error("Graph file has different byte order: " + path);
+        }
+        if (header->version != graph_file_version) {
+            throw std::runtime_error("Unsupported graph file version " + std::to_string(header->version));
+        }
+        if (header->file_size != file.size() || header->vertex_count >= file.size()) {
+            throw std::runtime_error("Corrupted graph file: size mismatch");
+        }
+        checkSection(header->name_offsets_pos, header->vertex_count + 1, sizeof(uint64_t));
+        checkSection(header->row_offsets_pos, header->vertex_count + 1, sizeof(uint64_t));
+        checkSection(header->targets_pos, header->entry_count, sizeof(uint32_t));
+        checkSection(header->weights_pos, header->entry_count, sizeof(int32_t));
+        if (header->names_pos > file.size() || header->names_size > file.size() - header->names_pos) {
+            throw std::runtime_error("Corrupted graph file: section out of bounds");
+        }
+        if (section<uint64_t>(header->name_offsets_pos)[header->vertex_count] != header->names_size ||
+            section<uint64_t>(header->row_offsets_pos)[header->vertex_count] != header->entry_count) {
+            throw std::runtime_error("Corrupted graph file: inconsistent offsets");
+        }
+    }
+
+    // Полная проверка за O(V + E): смещения не убывают, индексы соседей меньше числа вершин
+    void validate() const {
+        checkOffsets(header->name_offsets_pos);
+        checkOffsets(header->row_offsets_pos);
+        const uint32_t *targets = section<uint32_t>(header->targets_pos);
+        for (uint64_t i = 0; i < header->entry_count; ++i) {
+            if (targets[i] >= header->vertex_count) {
+                throw std::runtime_error("Corrupted graph file: neighbor index out of range");
+            }
+        }
+    }
+
+    [[nodiscard]] size_t getVertexCount() const {
+        return header->vertex_count;
+    }
+
+    [[nodiscard]] size_t getEdgeCount() const {
+        return header->edge_count;
+    }
+
+    [[nodiscard]] VertexKind getVertexKind() const {
+        return header->vertex_kind;
+    }
+
+    std::string_view vertexName(size_t vertex) const {
+        const uint64_t *offsets = section<uint64_t>(header->name_offsets_pos);
+        return {section<char>(header->names_pos) + offsets[vertex], offsets[vertex + 1] - offsets[vertex]};
+    }
+
+    Span<const uint32_t> neighbors(size_t vertex) const {
+        const uint64_t *rows = section<uint64_t>(header->row_offsets_pos);
+        return {section<uint32_t>(header->targets_pos) + rows[vertex], rows[vertex + 1] - rows[vertex]};
+    }
+
+    Span<const int32_t> weights(size_t vertex) const {
+        const uint64_t *rows = section<uint64_t>(header->row_offsets_pos);
+        return {section<int32_t>(header->weights_pos) + rows[vertex], rows[vertex + 1] - rows[vertex]};
+    }
+
+    // Построение изменяемого Graph<T> из отображения (копирует данные)
+    template<typename T>
+    Graph<T> toGraph() const {
+        validate();
+        std::vector<T> vertices;
+        vertices.reserve(getVertexCount());
+        for (size_t v = 0; v < getVertexCount(); ++v) {
+            vertices.push_back(vertexFromString<T>(vertexName(v)));
+        }
+
+        IndexedEdgeChunks chunks(1);
+        chunks[0].reserve(getEdgeCount());
+        for (size_t v = 0; v < getVertexCount(); ++v) {
+            Span<const uint32_t> targets = neighbors(v);
+            Span<const int32_t> edge_weights = weights(v);
+            for (size_t i = 0; i < targets.size(); ++i) {
+                if (v <= targets[i]) {
+                    chunks[0].push_back({static_cast<uint32_t>(v), targets[i], edge_weights[i]});
+                }
+            }
+        }
+        return buildGraph(vertices, chunks);
+    }
+};
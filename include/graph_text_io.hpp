@@ -0,0 +1,408 @@
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "graph_io.hpp"
+#include "parallel.hpp"
+
+
+enum class GraphFormat {
+    Binary,       // .l4g - см. graph_io.hpp
+    EdgeList,     // строки "u v [w]"; строка из одного имени объявляет вершину
+    Dimacs,       // .gr, .dimacs - "p sp N M", дуги "a u v w" / рёбра "e u v [w]"
+    MatrixMarket  // .mtx - coordinate, pattern/integer/real
+};
+
+inline GraphFormat graphFormatFromPath(const std::string &path) {
+    auto ends_with = [&path](const std::string &suffix) {
+        return path.size() >= suffix.size() && path.compare(path.size() - suffix.size(), suffix.size(), suffix) == 0;
+    };
+    if (ends_with(".l4g")) {
+        return GraphFormat::Binary;
+    } else if (ends_with(".gr") || ends_with(".dimacs")) {
+        return GraphFormat::Dimacs;
+    } else if (ends_with(".mtx")) {
+        return GraphFormat::MatrixMarket;
+    }
+    return GraphFormat::EdgeList;
+}
+
+struct ImportStats {
+    size_t bytes = 0;
+    size_t vertices = 0;
+    size_t edges = 0;
+    double parse_seconds = 0;
+    double total_seconds = 0;
+
+    // Скорость разбора текста, МБ/с
+    [[nodiscard]] double throughput() const {
+        return parse_seconds > 0 ? bytes / parse_seconds / (1024.0 * 1024.0) : 0;
+    }
+};
+
+constexpr size_t text_import_block_size = 16 << 20; // Читаем файл блоками по 16 МБ
+constexpr size_t text_import_min_chunk = 256 << 10;  // Минимальный кусок блока для одного потока
+constexpr int text_import_default_weight = 1;        // Вес рёбер в файлах без весов
+
+namespace text_import {
+
+    // Результат разбора одного куска: имена и рёбра в локальной нумерации куска
+    struct ParsedChunk {
+        std::unordered_map<std::string_view, uint32_t> ids;
+        std::vector<std::string_view> names;
+        std::vector<IndexedEdge> edges;
+        size_t declared_vertices = 0;
+
+        uint32_t intern(std::string_view name) {
+            auto inserted = ids.emplace(name, static_cast<uint32_t>(names.size()));
+            if (inserted.second) {
+                names.push_back(name);
+            }
+            return inserted.first->second;
+        }
+    };
+
+    inline bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    inline std::string_view nextToken(std::string_view &line) {
+        size_t begin = 0;
+        while (begin < line.size() && isSpace(line[begin])) ++begin;
+        size_t end = begin;
+        while (end < line.size() && !isSpace(line[end])) ++end;
+        std::string_view token = line.substr(begin, end - begin);
+        line.remove_prefix(end);
+        return token;
+    }
+
+    template<typename Number>
+    Number parseNumber(std::string_view token, std::string_view line) {
+        Number value{};
+        auto result = std::from_chars(token.data(), token.data() + token.size(), value);
+        if (token.empty() || result.ec != std::errc() || result.ptr != token.data() + token.size()) {
+            throw std::runtime_error("Malformed line: " + std::string(line));
+        }
+        return value;
+    }
+
+    inline int parseWeight(std::string_view token, std::string_view line, bool real) {
+        if (token.empty()) {
+            return text_import_default_weight;
+        }
+        if (real) {
+            return static_cast<int>(std::lround(parseNumber<double>(token, line)));
+        }
+        return parseNumber<int>(token, line);
+    }
+
+    inline void parseLine(std::string_view line, GraphFormat format, bool real_weights, ParsedChunk &chunk) {
+        std::string_view rest = line;
+        std::string_view first = nextToken(rest);
+        if (first.empty() || first[0] == '#' || first[0] == '%') {
+            return;
+        }
+
+        if (format == GraphFormat::Dimacs) {
+            if (first == "c") {
+                return;
+            }
+            if (first == "p") {
+                nextToken(rest);
+                // Вершины 1..N из строки "p" добавляются при слиянии кусков
+                chunk.declared_vertices = parseNumber<size_t>(nextToken(rest), line);
+                return;
+            }
+            if (first != "a" && first != "e") {
+                throw std::runtime_error("Malformed line: " + std::string(line));
+            }
+            first = nextToken(rest);
+        }
+
+        std::string_view second = nextToken(rest);
+        if (second.empty()) {
+            if (format != GraphFormat::EdgeList) {
+                throw std::runtime_error("Malformed line: " + std::string(line));
+            }
+            chunk.intern(first);
+            return;
+        }
+        if (format != GraphFormat::EdgeList) {
+            parseNumber<uint32_t>(first, line);
+            parseNumber<uint32_t>(second, line);
+        }
+        int weight = parseWeight(nextToken(rest), line, real_weights);
+        uint32_t from = chunk.intern(first);
+        uint32_t to = chunk.intern(second);
+        chunk.edges.push_back({from, to, weight});
+    }
+
+    inline void parseText(std::string_view text, GraphFormat format, bool real_weights, ParsedChunk &chunk) {
+        while (!text.empty()) {
+            size_t end = text.find('\n');
+            std::string_view line = text.substr(0, end);
+            parseLine(line, format, real_weights, chunk);
+            text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+        }
+    }
+
+    // Заголовок Matrix Market: баннер, комментарии и строка размеров.
+    // Возвращает, вещественные ли значения, и сдвигает text за строку размеров.
+    inline bool consumeMatrixMarketHeader(std::string_view &text, size_t &declared_vertices) {
+        size_t end = text.find('\n');
+        std::string_view banner = text.substr(0, end);
+        std::string_view rest = banner;
+        if (nextToken(rest) != "%%MatrixMarket" || nextToken(rest) != "matrix" || nextToken(rest) != "coordinate") {
+            throw std::runtime_error("Only coordinate Matrix Market files are supported");
+        }
+        std::string_view field = nextToken(rest);
+        if (field != "pattern" && field != "integer" && field != "real") {
+            throw std::runtime_error("Unsupported Matrix Market field: " + std::string(field));
+        }
+
+        while (end != std::string_view::npos) {
+            text.remove_prefix(end + 1);
+            end = text.find('\n');
+            std::string_view line = text.substr(0, end);
+            std::string_view tokens = line;
+            std::string_view rows = nextToken(tokens);
+            if (rows.empty() || rows[0] == '%') {
+                continue;
+            }
+            size_t cols = parseNumber<size_t>(nextToken(tokens), line);
+            declared_vertices = std::max(parseNumber<size_t>(rows, line), cols);
+            text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+            return field == "real";
+        }
+        throw std::runtime_error("Matrix Market size line is missing");
+    }
+
+    // Делит блок на куски по границам строк
+    inline std::vector<std::string_view> splitLines(std::string_view text, size_t parts) {
+        std::vector<std::string_view> pieces;
+        size_t piece_size = std::max(text_import_min_chunk, text.size() / std::max<size_t>(parts, 1) + 1);
+        while (!text.empty()) {
+            size_t end = text.size() <= piece_size ? std::string_view::npos : text.find('\n', piece_size);
+            end = end == std::string_view::npos ? text.size() : end + 1;
+            pieces.push_back(text.substr(0, end));
+            text.remove_prefix(end);
+        }
+        return pieces;
+    }
+}
+
+// Потоковый импорт текстового графа: файл читается блоками, каждый блок режется по строкам
+// и разбирается параллельно (свой словарь имён на кусок), затем куски сливаются в общую
+// нумерацию вершин, а граф строится одним пакетом через buildGraph.
+template<typename T>
+Graph<T> loadGraphText(const std::string &path, GraphFormat format, ImportStats *stats = nullptr,
+                       unsigned threads = 0) {
+    auto start = std::chrono::steady_clock::now();
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot open file: " + path);
+    }
+
+    std::unordered_map<std::string, uint32_t> ids;
+    std::vector<std::string> names;
+    IndexedEdgeChunks chunks;
+    size_t declared_vertices = 0;
+    bool real_weights = false;
+    bool first_block = true;
+    size_t bytes = 0;
+    unsigned workers = resolveThreadCount(threads);
+
+    auto intern = [&](const std::string &name) {
+        auto inserted = ids.emplace(name, static_cast<uint32_t>(names.size()));
+        if (inserted.second) {
+            names.push_back(name);
+        }
+        return inserted.first->second;
+    };
+
+    std::string buffer;
+    std::string carry;
+    while (in) {
+        buffer.swap(carry);
+        size_t kept = buffer.size();
+        buffer.resize(kept + text_import_block_size);
+        in.read(&buffer[kept], text_import_block_size);
+        size_t read = static_cast<size_t>(in.gcount());
+        bytes += read;
+        buffer.resize(kept + read);
+
+        carry.clear();
+        if (in) {
+            size_t last_line = buffer.rfind('\n');
+            if (last_line == std::string::npos) {
+                carry.swap(buffer);
+                continue;
+            }
+            carry.assign(buffer, last_line + 1, std::string::npos);
+            buffer.resize(last_line + 1);
+        }
+
+        std::string_view text(buffer);
+        if (first_block && format == GraphFormat::MatrixMarket) {
+            real_weights = text_import::consumeMatrixMarketHeader(text, declared_vertices);
+        }
+        first_block = false;
+
+        std::vector<std::string_view> pieces = text_import::splitLines(text, workers * 4);
+        std::vector<text_import::ParsedChunk> parsed(pieces.size());
+        parallelFor(pieces.size(), workers, [&](size_t i) {
+            text_import::parseText(pieces[i], format, real_weights, parsed[i]);
+        });
+
+        for (auto &chunk: parsed) {
+            declared_vertices = std::max(declared_vertices, chunk.declared_vertices);
+            std::vector<uint32_t> global(chunk.names.size());
+            for (size_t i = 0; i < chunk.names.size(); ++i) {
+                global[i] = intern(std::string(chunk.names[i]));
+            }
+            for (auto &edge: chunk.edges) {
+                edge.from = global[edge.from];
+                edge.to = global[edge.to];
+            }
+            chunks.push_back(std::move(chunk.edges));
+        }
+    }
+    auto parsed_at = std::chrono::steady_clock::now();
+
+    // Вершины, объявленные заголовком DIMACS/Matrix Market, но без рёбер
+    for (size_t v = 1; v <= declared_vertices; ++v) {
+        intern(std::to_string(v));
+    }
+
+    std::vector<T> vertices;
+    vertices.reserve(names.size());
+    for (const auto &name: names) {
+        vertices.push_back(vertexFromString<T>(name));
+    }
+    Graph<T> graph = buildGraph(vertices, chunks);
+
+    if (stats) {
+        auto finish = std::chrono::steady_clock::now();
+        stats->bytes = bytes;
+        stats->vertices = graph.getVertexCount();
+        stats->edges = graph.getEdges().getSize();
+        stats->parse_seconds = std::chrono::duration<double>(parsed_at - start).count();
+        stats->total_seconds = std::chrono::duration<double>(finish - start).count();
+    }
+    return graph;
+}
+
+// Номера вершин для DIMACS/Matrix Market: сохраняются, если имена уже целые 1..N, иначе 1..V по порядку
+template<typename T>
+std::unordered_map<T, size_t> numberVertices(const HashTable<T, ArraySequence<T>> &adjacency, size_t &count) {
+    std::unordered_map<T, size_t> numbers;
+    count = 0;
+    bool numeric = true;
+    for (const auto &pair: adjacency) {
+        std::string name = vertexToString(pair.first);
+        size_t value = 0;
+        auto result = std::from_chars(name.data(), name.data() + name.size(), value);
+        if (result.ec != std::errc() || result.ptr != name.data() + name.size() || value == 0) {
+            numeric = false;
+            break;
+        }
+        numbers.emplace(pair.first, value);
+        count = std::max(count, value);
+    }
+    if (!numeric) {
+        numbers.clear();
+        count = 0;
+        for (const auto &pair: adjacency) {
+            numbers.emplace(pair.first, ++count);
+        }
+    }
+    return numbers;
+}
+
+template<typename T>
+void saveGraphText(const Graph<T> &graph, const std::string &path, GraphFormat format) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open file for writing: " + path);
+    }
+    HashTable<T, ArraySequence<T>> adjacency = graph.getAdjacencyList();
+    ArraySequence<Edge<T>> edges = graph.getEdges();
+
+    if (format == GraphFormat::EdgeList) {
+        for (const auto &pair: adjacency) {
+            if (pair.second.getSize() == 0) {
+                out << vertexToString(pair.first) << '\n';
+            }
+        }
+        for (const auto &edge: edges) {
+            out << vertexToString(edge.vertex1) << ' ' << vertexToString(edge.vertex2) << ' ' << edge.weight << '\n';
+        }
+    } else if (format == GraphFormat::Dimacs) {
+        size_t count;
+        std::unordered_map<T, size_t> numbers = numberVertices(adjacency, count);
+        out << "p sp " << count << ' ' << edges.getSize() * 2 << '\n';
+        for (const auto &edge: edges) {
+            size_t from = numbers.at(edge.vertex1);
+            size_t to = numbers.at(edge.vertex2);
+            out << "a " << from << ' ' << to << ' ' << edge.weight << '\n';
+            out << "a " << to << ' ' << from << ' ' << edge.weight << '\n';
+        }
+    } else if (format == GraphFormat::MatrixMarket) {
+        size_t count;
+        std::unordered_map<T, size_t> numbers = numberVertices(adjacency, count);
+        out << "%%MatrixMarket matrix coordinate integer symmetric\n";
+        out << count << ' ' << count << ' ' << edges.getSize() << '\n';
+        for (const auto &edge: edges) {
+            size_t from = numbers.at(edge.vertex1);
+            size_t to = numbers.at(edge.vertex2);
+            out << std::max(from, to) << ' ' << std::min(from, to) << ' ' << edge.weight << '\n';
+        }
+    } else {
+        throw std::invalid_argument("Not a text graph format");
+    }
+    if (!out) {
+        throw std::runtime_error("Failed to write graph file: " + path);
+    }
+}
+
+template<typename T>
+Graph<T> loadGraphBinary(const std::string &path, ImportStats *stats = nullptr) {
+    auto start = std::chrono::steady_clock::now();
+    MappedGraph mapped(path);
+    auto mapped_at = std::chrono::steady_clock::now();
+    Graph<T> graph = mapped.toGraph<T>();
+    if (stats) {
+        auto finish = std::chrono::steady_clock::now();
+        stats->bytes = std::ifstream(path, std::ios::binary | std::ios::ate).tellg();
+        stats->vertices = mapped.getVertexCount();
+        stats->edges = mapped.getEdgeCount();
+        stats->parse_seconds = std::chrono::duration<double>(mapped_at - start).count();
+        stats->total_seconds = std::chrono::duration<double>(finish - start).count();
+    }
+    return graph;
+}
+
+// Загрузка и сохранение с выбором формата по расширению файла
+template<typename T>
+Graph<T> loadGraph(const std::string &path, ImportStats *stats = nullptr, unsigned threads = 0) {
+    GraphFormat format = graphFormatFromPath(path);
+    if (format == GraphFormat::Binary) {
+        return loadGraphBinary<T>(path, stats);
+    }
+    return loadGraphText<T>(path, format, stats, threads);
+}
+
+template<typename T>
+void saveGraph(const Graph<T> &graph, const std::string &path) {
+    GraphFormat format = graphFormatFromPath(path);
+    if (format == GraphFormat::Binary) {
+        saveGraphBinary(graph, path);
+    } else {
+        saveGraphText(graph, path, format);
+    }
+}
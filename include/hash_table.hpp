@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdexcept>
+#include <utility>
 #include "array_sequence.hpp"
 #include "list_sequence.hpp"
 #include "hash_table_iterators.hpp"
@@ -30,7 +31,8 @@ struct HashNode {
 
     HashNode() : isOccupied(false) {}
 
-    HashNode(const K &k, const V &v) : key(k), value(v), isOccupied(true) {}
+    template<typename KArg, typename VArg>
+    HashNode(KArg &&k, VArg &&v) : key(std::forward<KArg>(k)), value(std::forward<VArg>(v)), isOccupied(true) {}
 };
 
 template<typename K, typename V>
@@ -82,12 +84,12 @@ private:
             newTable.add(ListSequence<HashNode<K, V>>());
         }
 
-        for (auto it = table.begin(); it != table.end(); ++it) {
-            for (auto inner_it = (*it).begin(); inner_it != (*it).end(); ++inner_it) {
-                const auto &node = *inner_it;
+        // Узлы переносятся, а не копируются: старая таблица сразу после этого удаляется
+        for (auto &bucket : table) {
+            for (auto &node : bucket) {
                 if (node.isOccupied) {
                     size_t newIndex = getHashCode(node.key) % new_capacity;
-                    newTable.get(newIndex).add(node);
+                    newTable.get(newIndex).add(std::move(node));
                 }
             }
         }
@@ -113,6 +115,21 @@ private:
         return table.get(index);
     }
 
+    template<typename VArg>
+    void emplaceValue(const K &key, VArg &&value) {
+        ListSequence<HashNode<K, V>> &bucket = getBucket(key);
+
+        for (auto& node : bucket) {
+            if (isMatchingNode(node, key)) {
+                node.value = std::forward<VArg>(value);
+                return;
+            }
+        }
+        bucket.emplace(key, std::forward<VArg>(value));
+        ++size_table;
+        checkAndResize();
+    }
+
     bool isMatchingNode(const HashNode<K, V>& node, const K& key) const {
         return node.isOccupied && node.key == key;
     }
@@ -144,17 +161,11 @@ public:
     }
 
     void insert(const K &key, const V &value) {
-        ListSequence<HashNode<K, V>> &bucket = getBucket(key);
+        emplaceValue(key, value);
+    }
 
-        for (auto& node : bucket) {
-            if (isMatchingNode(node, key)) {
-                node.value = value;
-                return;
-            }
-        }
-        bucket.add(HashNode<K, V>(key, value));
-        ++size_table;
-        checkAndResize();
+    void insert(const K &key, V &&value) {
+        emplaceValue(key, std::move(value));
     }
 
     const V &get(const K &key) const {
@@ -193,6 +204,11 @@ public:
         return size_table;
     }
 
+    // Текущее число бакетов (ключ попадает в бакет hash(key) % bucketCount())
+    [[nodiscard]] size_t bucketCount() const {
+        return capacity;
+    }
+
     bool contains(const K &key) const {
         const ListSequence<HashNode<K, V>> &bucket = getBucket(key);
         return findNode(bucket, key) != nullptr;
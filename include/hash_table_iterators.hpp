@@ -1,27 +1,41 @@
 #pragma once
 
 #include <stdexcept>
+#include "list_sequence.hpp"
 
 template<typename K, typename V>
 class HashTable;
 
+template<typename K, typename V>
+struct HashNode;
+
 template<typename K, typename V>
 class HashTableIterator {
 private:
+    using NodeIterator = typename ListSequence<HashNode<K, V>>::ListIterator;
+
     HashTable<K, V>* hash_table;
     size_t bucket_index;
     size_t node_index;
+    NodeIterator cursor;  // Курсор по цепочке: узел с номером node_index в бакете bucket_index
+
+    NodeIterator bucketBegin() const {
+        if (bucket_index >= hash_table->capacity) {
+            return NodeIterator(nullptr);
+        }
+        return hash_table->table.uncheckedAt(bucket_index).begin();
+    }
 
     void findNextValid() {
         while (bucket_index < hash_table->capacity) {
-            while (node_index < hash_table->table.get(bucket_index).getSize()) {
-                if (hash_table->table.get(bucket_index).get(node_index).isOccupied) {
+            for (NodeIterator last(nullptr); cursor != last; ++cursor, ++node_index) {
+                if (cursor->isOccupied) {
                     return;
                 }
-                ++node_index;
             }
             ++bucket_index;
             node_index = 0;
+            cursor = bucketBegin();
         }
     }
 
@@ -33,10 +47,14 @@ public:
     using value_type = std::pair<K, V>;
 
     explicit HashTableIterator(HashTable<K, V>* table, size_t bucket = 0, size_t node = 0)
-            : hash_table(table), bucket_index(bucket), node_index(node) {
+            : hash_table(table), bucket_index(bucket), node_index(node), cursor(nullptr) {
         if (!hash_table) {
             throw std::runtime_error("HashTable is NULL");
         }
+        cursor = bucketBegin();
+        for (size_t i = 0; i < node_index && cursor != NodeIterator(nullptr); ++i) {
+            ++cursor;
+        }
         findNextValid();
     }
 
@@ -44,13 +62,13 @@ public:
         if (bucket_index >= hash_table->capacity) {
             throw std::runtime_error("Iterator is out of range");
         }
-        return std::make_pair(hash_table->table.get(bucket_index).get(node_index).key,
-                              hash_table->table.get(bucket_index).get(node_index).value);
+        return std::make_pair(cursor->key, cursor->value);
     }
 
 
     HashTableIterator& operator++() {
         ++node_index;
+        ++cursor;
         findNextValid();
         return *this;
     }
@@ -105,20 +123,30 @@ public:
 template<typename K, typename V>
 class ConstHashTableIterator {
 private:
+    using NodeIterator = typename ListSequence<HashNode<K, V>>::ConstListIterator;
+
     const HashTable<K, V>* hash_table;
     size_t bucket_index;
     size_t node_index;
+    NodeIterator cursor;  // Курсор по цепочке: узел с номером node_index в бакете bucket_index
+
+    NodeIterator bucketBegin() const {
+        if (bucket_index >= hash_table->capacity) {
+            return NodeIterator(nullptr);
+        }
+        return hash_table->table.uncheckedAt(bucket_index).begin();
+    }
 
     void findNextValid() {
         while (bucket_index < hash_table->capacity) {
-            while (node_index < hash_table->table.get(bucket_index).getSize()) {
-                if (hash_table->table.get(bucket_index).get(node_index).isOccupied) {
+            for (NodeIterator last(nullptr); cursor != last; ++cursor, ++node_index) {
+                if (cursor->isOccupied) {
                     return;
                 }
-                ++node_index;
             }
             ++bucket_index;
             node_index = 0;
+            cursor = bucketBegin();
         }
     }
 
@@ -130,10 +158,14 @@ public:
     using value_type = std::pair<const K, const V>;
 
     explicit ConstHashTableIterator(const HashTable<K, V>* table, size_t bucket = 0, size_t node = 0)
-            : hash_table(table), bucket_index(bucket), node_index(node) {
+            : hash_table(table), bucket_index(bucket), node_index(node), cursor(nullptr) {
         if (!hash_table) {
             throw std::runtime_error("HashTable is NULL");
         }
+        cursor = bucketBegin();
+        for (size_t i = 0; i < node_index && cursor != NodeIterator(nullptr); ++i) {
+            ++cursor;
+        }
         findNextValid();
     }
 
@@ -141,12 +173,12 @@ public:
         if (bucket_index >= hash_table->capacity) {
             throw std::runtime_error("Iterator is out of range");
         }
-        return std::make_pair(hash_table->table.get(bucket_index).get(node_index).key,
-                              hash_table->table.get(bucket_index).get(node_index).value);
+        return std::make_pair(cursor->key, cursor->value);
     }
 
     ConstHashTableIterator& operator++() {
         ++node_index;
+        ++cursor;
         findNextValid();
         return *this;
     }
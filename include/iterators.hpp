@@ -1,73 +1,130 @@
 #pragma once
 
-template<typename T>
-class Iterator {
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+
+// Итератор произвольного доступа по непрерывному буферу (Sequence, ArraySequence).
+// Полный набор операций и typedef'ы iterator_traits позволяют использовать стандартные
+// алгоритмы (std::sort, std::lower_bound, std::reverse и т.д.) прямо на последовательностях.
+template<typename T, bool IsConst>
+class ContiguousIterator {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const T *, T *>;
+    using reference = std::conditional_t<IsConst, const T &, T &>;
+
 private:
-    T* ptr;
+    pointer ptr;
+
+    friend class ContiguousIterator<T, !IsConst>;
 
 public:
-    explicit Iterator(T* ptr) : ptr(ptr) {}
+    ContiguousIterator() : ptr(nullptr) {}
+
+    explicit ContiguousIterator(pointer ptr) : ptr(ptr) {}
+
+    // Iterator -> ConstIterator
+    template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+    ContiguousIterator(const ContiguousIterator<T, OtherConst> &other) : ptr(other.ptr) {}
 
-    T& operator*() const {
+    reference operator*() const {
         return *ptr;
     }
 
-    T* operator->() const {
+    pointer operator->() const {
         return ptr;
     }
 
-    Iterator& operator++() {
+    reference operator[](difference_type offset) const {
+        return ptr[offset];
+    }
+
+    ContiguousIterator &operator++() {
         ++ptr;
         return *this;
     }
 
-    Iterator operator++(int) {
-        Iterator temp = *this;
-        ++(*this);
+    ContiguousIterator operator++(int) {
+        ContiguousIterator temp = *this;
+        ++ptr;
         return temp;
     }
 
-    bool operator==(const Iterator& other) const {
-        return ptr == other.ptr;
+    ContiguousIterator &operator--() {
+        --ptr;
+        return *this;
     }
 
-    bool operator!=(const Iterator& other) const {
-        return !(*this == other);
+    ContiguousIterator operator--(int) {
+        ContiguousIterator temp = *this;
+        --ptr;
+        return temp;
     }
-};
 
-template<typename T>
-class ConstIterator {
-private:
-    const T* ptr;
+    ContiguousIterator &operator+=(difference_type offset) {
+        ptr += offset;
+        return *this;
+    }
 
-public:
-    explicit ConstIterator(const T* ptr) : ptr(ptr) {}
+    ContiguousIterator &operator-=(difference_type offset) {
+        ptr -= offset;
+        return *this;
+    }
 
-    const T& operator*() const {
-        return *ptr;
+    ContiguousIterator operator+(difference_type offset) const {
+        return ContiguousIterator(ptr + offset);
     }
 
-    const T* operator->() const {
-        return ptr;
+    friend ContiguousIterator operator+(difference_type offset, const ContiguousIterator &it) {
+        return it + offset;
     }
 
-    ConstIterator& operator++() {
-        ++ptr;
-        return *this;
+    ContiguousIterator operator-(difference_type offset) const {
+        return ContiguousIterator(ptr - offset);
     }
 
-    ConstIterator operator++(int) {
-        ConstIterator temp = *this;
-        ++(*this);
-        return temp;
+    template<bool OtherConst>
+    difference_type operator-(const ContiguousIterator<T, OtherConst> &other) const {
+        return ptr - other.ptr;
     }
 
-    bool operator==(const ConstIterator& other) const {
+    template<bool OtherConst>
+    bool operator==(const ContiguousIterator<T, OtherConst> &other) const {
         return ptr == other.ptr;
     }
 
-    bool operator!=(const ConstIterator& other) const {
-        return !(*this == other);
+    template<bool OtherConst>
+    bool operator!=(const ContiguousIterator<T, OtherConst> &other) const {
+        return ptr != other.ptr;
+    }
+
+    template<bool OtherConst>
+    bool operator<(const ContiguousIterator<T, OtherConst> &other) const {
+        return ptr < other.ptr;
+    }
+
+    template<bool OtherConst>
+    bool operator>(const ContiguousIterator<T, OtherConst> &other) const {
+        return ptr > other.ptr;
+    }
+
+    template<bool OtherConst>
+    bool operator<=(const ContiguousIterator<T, OtherConst> &other) const {
+        return ptr <= other.ptr;
+    }
+
+    template<bool OtherConst>
+    bool operator>=(const ContiguousIterator<T, OtherConst> &other) const {
+        return ptr >= other.ptr;
     }
-};
\ No newline at end of file
+};
+
+template<typename T>
+using Iterator = ContiguousIterator<T, false>;
+
+template<typename T>
+using ConstIterator = ContiguousIterator<T, true>;
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+// Гистограмма задержек в наносекундах с логарифмически-линейными корзинами (как в HdrHistogram):
+// значения до 2^sub_bucket_bits хранятся точно, дальше каждая степень двойки делится на
+// 2^(sub_bucket_bits - 1) корзин, то есть относительная погрешность не больше 1/64.
+// Запись - O(1) без выделений памяти, вся гистограмма ~30 КБ. Подходит для замеров отдельных операций
+// (вставки с перестройкой HashTable, сдвиги ArraySequence::remove), которые теряются в среднем времени.
+class LatencyHistogram {
+private:
+    static constexpr unsigned sub_bucket_bits = 7;
+    static constexpr uint64_t sub_bucket_count = uint64_t(1) << sub_bucket_bits;
+    static constexpr uint64_t half_count = sub_bucket_count / 2;
+    static constexpr size_t bucket_total = sub_bucket_count + (64 - sub_bucket_bits) * half_count;
+
+    std::vector<uint64_t> counts;
+    uint64_t total;
+    uint64_t min_value;
+    uint64_t max_value;
+    double sum;
+
+    static unsigned highestBit(uint64_t value) {
+        unsigned bit = 0;
+        while (value >>= 1) {
+            ++bit;
+        }
+        return bit;
+    }
+
+    static size_t bucketIndex(uint64_t value) {
+        if (value < sub_bucket_count) {
+            return static_cast<size_t>(value);
+        }
+        unsigned shift = highestBit(value) - (sub_bucket_bits - 1);
+        return static_cast<size_t>((uint64_t(shift) << (sub_bucket_bits - 1)) + (value >> shift));
+    }
+
+    // Наибольшее значение, попадающее в корзину
+    static uint64_t bucketUpperBound(size_t index) {
+        if (index < sub_bucket_count) {
+            return index;
+        }
+        unsigned shift = static_cast<unsigned>(index >> (sub_bucket_bits - 1)) - 1;
+        uint64_t mantissa = index - (uint64_t(shift) << (sub_bucket_bits - 1));
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+public:
+    LatencyHistogram() : counts(bucket_total, 0), total(0), min_value(UINT64_MAX), max_value(0), sum(0) {}
+
+    void record(uint64_t value) {
+        ++counts[bucketIndex(value)];
+        ++total;
+        min_value = std::min(min_value, value);
+        max_value = std::max(max_value, value);
+        sum += static_cast<double>(value);
+    }
+
+    void merge(const LatencyHistogram &other) {
+        for (size_t i = 0; i < counts.size(); ++i) {
+            counts[i] += other.counts[i];
+        }
+        total += other.total;
+        min_value = std::min(min_value, other.min_value);
+        max_value = std::max(max_value, other.max_value);
+        sum += other.sum;
+    }
+
+    void reset() {
+        std::fill(counts.begin(), counts.end(), 0);
+        total = 0;
+        min_value = UINT64_MAX;
+        max_value = 0;
+        sum = 0;
+    }
+
+    [[nodiscard]] uint64_t count() const {
+        return total;
+    }
+
+    [[nodiscard]] uint64_t min() const {
+        return total ? min_value : 0;
+    }
+
+    [[nodiscard]] uint64_t max() const {
+        return max_value;
+    }
+
+    [[nodiscard]] double mean() const {
+        return total ? sum / static_cast<double>(total) : 0;
+    }
+
+    // Значение, не меньше которого percent процентов записей (0..100); верхняя граница корзины
+    [[nodiscard]] uint64_t percentile(double percent) const {
+        if (total == 0) {
+            return 0;
+        }
+        auto rank = static_cast<uint64_t>(percent / 100.0 * static_cast<double>(total) + 0.5);
+        rank = std::max<uint64_t>(1, std::min(rank, total));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < counts.size(); ++i) {
+            seen += counts[i];
+            if (seen >= rank) {
+                return std::min(bucketUpperBound(i), max_value);
+            }
+        }
+        return max_value;
+    }
+
+    // Точки графика "задержка от процентиля" в духе HdrHistogram: процентиль 100 * (1 - 10^-k) для k от 0
+    // с шагом 1 / points_per_decade, пока 10^k не превысит число записей (p99.9 имеет смысл от 1000 записей).
+    // Последняя точка - максимум (процентиль 100)
+    [[nodiscard]] std::vector<std::pair<double, uint64_t>> percentileCurve(size_t points_per_decade = 10) const {
+        std::vector<std::pair<double, uint64_t>> curve;
+        if (total == 0) {
+            return curve;
+        }
+        double decades = std::log10(static_cast<double>(total)) + 1e-9;
+        size_t steps = static_cast<size_t>(decades * static_cast<double>(points_per_decade));
+        for (size_t i = 0; i <= steps; ++i) {
+            double percent = 100.0 * (1.0 - std::pow(10.0, -static_cast<double>(i) / points_per_decade));
+            curve.emplace_back(percent, percentile(percent));
+        }
+        curve.emplace_back(100.0, max_value);
+        return curve;
+    }
+};
+
+
+// Замер области видимости: при выходе записывает прошедшие наносекунды в гистограмму
+class ScopedLatency {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    LatencyHistogram &histogram;
+    Clock::time_point start;
+
+public:
+    explicit ScopedLatency(LatencyHistogram &histogram) : histogram(histogram), start(Clock::now()) {}
+
+    ~ScopedLatency() {
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        histogram.record(elapsed > 0 ? static_cast<uint64_t>(elapsed) : 0);
+    }
+
+    ScopedLatency(const ScopedLatency &) = delete;
+
+    ScopedLatency &operator=(const ScopedLatency &) = delete;
+};
\ No newline at end of file
@@ -1,129 +1,203 @@
 #pragma once
 
+#include <cstddef>
+#include <iterator>
 #include <stdexcept>
 #include <utility>
-#include "sequence.hpp"
+#include "sequence_base.hpp"
 
 
 template<typename T>
-class ListSequence : public Sequence<T> {
+class ListSequence : public SequenceBase<ListSequence<T>, T> {
 private:
-    struct Node {
+    struct NodeBase {
+        NodeBase *next = nullptr;
+    };
+
+    struct Node : NodeBase {
         T data;
-        Node *next;
 
-        explicit Node(const T &data) : data(data), next(nullptr) {}
+        template<typename... Args>
+        explicit Node(Args &&...args) : NodeBase(), data(std::forward<Args>(args)...) {}
     };
 
-    Node *head;
+    NodeBase before_head;  // Фиктивный узел перед первым: позиция beforeBegin() для insertAfter/eraseAfter
     Node *tail;
+    size_t size;
 
-public:
-    ListSequence() : head(nullptr), tail(nullptr) {
-        Sequence<T>::size = 0;
+    // Кеш последнего узла, найденного по индексу: последовательные get(i), get(i + 1), ...
+    // продолжают обход с него, а не с головы (O(1) амортизированно вместо O(n)).
+    // Кеш сдвигают только неконстантные методы, const get() его лишь читает, поэтому
+    // параллельное чтение константного списка из нескольких потоков безопасно
+    Node *cursor;
+    size_t cursor_index;
+
+    Node *head() const {
+        return static_cast<Node *>(before_head.next);
     }
 
-    ListSequence(const ListSequence &other) : Sequence<T>(other.getSize()) {
-        head = nullptr;
-        tail = nullptr;
-        Node *current = other.head;
-        while (current) {
-            add(current->data);
-            current = current->next;
+    Node *findNode(size_t index) const {
+        if (index + 1 == size) {
+            return tail;
+        }
+        Node *current = head();
+        size_t position = 0;
+        if (cursor && cursor_index <= index) {
+            current = cursor;
+            position = cursor_index;
+        }
+        for (; position < index; ++position) {
+            current = static_cast<Node *>(current->next);
+        }
+        return current;
+    }
+
+    Node *nodeAt(size_t index) {
+        Node *current = findNode(index);
+        cursor = current;
+        cursor_index = index;
+        return current;
+    }
+
+    NodeBase *nodeBefore(size_t index) {
+        return index == 0 ? &before_head : nodeAt(index - 1);
+    }
+
+    void linkAfter(NodeBase *prev, Node *node) {
+        node->next = prev->next;
+        prev->next = node;
+        if (!node->next) {
+            tail = node;
+        }
+        ++size;
+    }
+
+    void unlinkAfter(NodeBase *prev) {
+        Node *removed = static_cast<Node *>(prev->next);
+        prev->next = removed->next;
+        if (removed == tail) {
+            tail = prev == &before_head ? nullptr : static_cast<Node *>(prev);
+        }
+        delete removed;
+        --size;
+    }
+
+    // Вставка перед index (index == getSize() - в конец)
+    template<typename... Args>
+    T &emplaceAt(size_t index, Args &&...args) {
+        if (index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        if (index == size) {
+            return emplace(std::forward<Args>(args)...);
+        }
+        Node *newNode = new Node(std::forward<Args>(args)...);
+        linkAfter(nodeBefore(index), newNode);
+        if (index == 0) {
+            cursor = nullptr;
+        }
+        return newNode->data;
+    }
+
+public:
+    ListSequence() : tail(nullptr), size(0), cursor(nullptr), cursor_index(0) {}
+
+    ListSequence(const ListSequence &other) : ListSequence() {
+        for (const T &element : other) {
+            add(element);
         }
     }
 
     ListSequence(ListSequence &&other) noexcept
-            : Sequence<T>(std::move(other)),
-              head(other.head),
-              tail(other.tail) {
-        other.head = nullptr;
+            : tail(other.tail), size(other.size), cursor(nullptr), cursor_index(0) {
+        before_head.next = other.before_head.next;
+        other.before_head.next = nullptr;
         other.tail = nullptr;
+        other.size = 0;
+        other.cursor = nullptr;
     }
 
     ~ListSequence() {
         clear();
     }
 
-    void add(const T &element) override {
-        Node *newNode = new Node(element);
-        if (!head) {
-            head = tail = newNode;
-        } else {
-            tail->next = newNode;
-            tail = newNode;
+    void add(const T &element) {
+        emplace(element);
+    }
+
+    void add(T &&element) {
+        emplace(std::move(element));
+    }
+
+    // Элемент конструируется прямо в узле списка
+    template<typename... Args>
+    T &emplace(Args &&...args) {
+        Node *newNode = new Node(std::forward<Args>(args)...);
+        linkAfter(tail ? static_cast<NodeBase *>(tail) : &before_head, newNode);
+        return newNode->data;
+    }
+
+    void insert(size_t index, const T &element) {
+        emplaceAt(index, element);
+    }
+
+    void insert(size_t index, T &&element) {
+        emplaceAt(index, std::move(element));
+    }
+
+    // Пакетное добавление; для переноса вместо копирования - std::make_move_iterator
+    template<typename InputIt>
+    void append(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            emplace(*first);
         }
-        Sequence<T>::size++;
     }
 
-    void remove(size_t index) override {
-        if (index >= Sequence<T>::size) {
+    void remove(size_t index) {
+        if (index >= size) {
             throw std::out_of_range("Index out of range");
         }
-
-        Node *current = head;
+        unlinkAfter(nodeBefore(index));
         if (index == 0) {
-            head = head->next;
-            delete current;
-            if (!head) {
-                tail = nullptr;
-            }
-        } else {
-            Node *prev = nullptr;
-            for (size_t i = 0; i < index; ++i) {
-                prev = current;
-                current = current->next;
-            }
-            prev->next = current->next;
-            if (current == tail) {
-                tail = prev;
-            }
-            delete current;
+            cursor = nullptr;
         }
-        Sequence<T>::size--;
     }
 
-    T &get(size_t index) override {
-        if (index >= Sequence<T>::size) {
+    T &get(size_t index) {
+        if (index >= size) {
             throw std::out_of_range("Index out of range");
         }
-
-        Node *current = head;
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next;
-        }
-        return current->data;
+        return nodeAt(index)->data;
     }
 
-    const T &get(size_t index) const override {
-        if (index >= Sequence<T>::size) {
+    const T &get(size_t index) const {
+        if (index >= size) {
             throw std::out_of_range("Index out of range");
         }
+        return findNode(index)->data;
+    }
 
-        Node *current = head;
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next;
-        }
-        return current->data;
+    [[nodiscard]] size_t getSize() const {
+        return size;
+    }
+
+    // Элементы списка не лежат подряд
+    T *contiguousData() {
+        return nullptr;
     }
 
     void clear() {
-        while (head) {
-            Node *temp = head;
-            head = head->next;
-            delete temp;
+        while (before_head.next) {
+            unlinkAfter(&before_head);
         }
-        tail = nullptr;
-        Sequence<T>::size = 0;
+        cursor = nullptr;
     }
 
     ListSequence &operator=(const ListSequence &other) {
         if (this != &other) {
             clear();
-            Node *current = other.head;
-            while (current) {
-                add(current->data);
-                current = current->next;
+            for (const T &element : other) {
+                add(element);
             }
         }
         return *this;
@@ -132,11 +206,13 @@ public:
     ListSequence &operator=(ListSequence &&other) noexcept {
         if (this != &other) {
             clear();
-            head = other.head;
+            before_head.next = other.before_head.next;
             tail = other.tail;
-            Sequence<T>::size = other.Sequence<T>::size;
-            other.head = nullptr;
+            size = other.size;
+            other.before_head.next = nullptr;
             other.tail = nullptr;
+            other.size = 0;
+            other.cursor = nullptr;
         }
         return *this;
     }
@@ -145,32 +221,40 @@ public:
         if (this->getSize() != other.getSize()) {
             return false;
         }
-        Node *current1 = this->head;
-        Node *current2 = other.head;
+        Node *current1 = this->head();
+        Node *current2 = other.head();
 
         while (current1 && current2) {
             if (current1->data != current2->data) {
                 return false;
             }
-            current1 = current1->next;
-            current2 = current2->next;
+            current1 = static_cast<Node *>(current1->next);
+            current2 = static_cast<Node *>(current2->next);
         }
         return true;
     }
 
-    bool operator!=(const ListSequence &other) const {
-        return !(*this == other);
-    }
-
     class ListIterator {
     private:
-        Node *current;
+        NodeBase *current;
+
+        friend class ListSequence;
 
     public:
-        explicit ListIterator(Node *node) : current(node) {}
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+        explicit ListIterator(NodeBase *node) : current(node) {}
 
         T &operator*() const {
-            return current->data;
+            return static_cast<Node *>(current)->data;
+        }
+
+        T *operator->() const {
+            return &static_cast<Node *>(current)->data;
         }
 
         ListIterator &operator++() {
@@ -194,22 +278,37 @@ public:
     };
 
     ListIterator begin() {
-        return ListIterator(head);
+        return ListIterator(before_head.next);
     }
 
     ListIterator end() {
         return ListIterator(nullptr);
     }
 
+    // Позиция перед первым элементом (для insertAfter/eraseAfter/spliceAfter в начало)
+    ListIterator beforeBegin() {
+        return ListIterator(&before_head);
+    }
+
     class ConstListIterator {
     private:
-        const Node *current;
+        const NodeBase *current;
 
     public:
-        explicit ConstListIterator(const Node *node) : current(node) {}
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        explicit ConstListIterator(const NodeBase *node) : current(node) {}
 
         const T &operator*() const {
-            return current->data;
+            return static_cast<const Node *>(current)->data;
+        }
+
+        const T *operator->() const {
+            return &static_cast<const Node *>(current)->data;
         }
 
         ConstListIterator &operator++() {
@@ -233,7 +332,7 @@ public:
     };
 
     ConstListIterator begin() const {
-        return ConstListIterator(head);
+        return ConstListIterator(before_head.next);
     }
 
     ConstListIterator end() const {
@@ -241,10 +340,82 @@ public:
     }
 
     ConstListIterator cbegin() const {
-        return ConstListIterator(head);
+        return ConstListIterator(before_head.next);
     }
 
     ConstListIterator cend() const {
         return ConstListIterator(nullptr);
     }
-};
\ No newline at end of file
+
+    // Операции по позиции за O(1). Итераторы остаются действительными,
+    // кроме итератора на удалённый элемент.
+
+    template<typename... Args>
+    ListIterator emplaceAfter(ListIterator position, Args &&...args) {
+        Node *newNode = new Node(std::forward<Args>(args)...);
+        linkAfter(position.current, newNode);
+        cursor = nullptr;
+        return ListIterator(newNode);
+    }
+
+    ListIterator insertAfter(ListIterator position, const T &element) {
+        return emplaceAfter(position, element);
+    }
+
+    ListIterator insertAfter(ListIterator position, T &&element) {
+        return emplaceAfter(position, std::move(element));
+    }
+
+    // Удаляет элемент, следующий за position; возвращает итератор на элемент после удалённого
+    ListIterator eraseAfter(ListIterator position) {
+        if (!position.current || !position.current->next) {
+            throw std::out_of_range("No element after position");
+        }
+        unlinkAfter(position.current);
+        cursor = nullptr;
+        return ListIterator(position.current->next);
+    }
+
+    void pushFront(const T &element) {
+        emplaceAfter(beforeBegin(), element);
+    }
+
+    void pushFront(T &&element) {
+        emplaceAfter(beforeBegin(), std::move(element));
+    }
+
+    void popFront() {
+        if (!size) {
+            throw std::out_of_range("List is empty");
+        }
+        eraseAfter(beforeBegin());
+    }
+
+    // Переносит все узлы other после position без копирования элементов; other становится пустым
+    void spliceAfter(ListIterator position, ListSequence &other) {
+        if (&other == this) {
+            throw std::invalid_argument("Cannot splice a list into itself");
+        }
+        if (!other.size) {
+            return;
+        }
+        NodeBase *prev = position.current;
+        Node *last = other.tail;
+        last->next = prev->next;
+        prev->next = other.before_head.next;
+        if (!last->next) {
+            tail = last;
+        }
+        size += other.size;
+        cursor = nullptr;
+
+        other.before_head.next = nullptr;
+        other.tail = nullptr;
+        other.size = 0;
+        other.cursor = nullptr;
+    }
+
+    void spliceAfter(ListIterator position, ListSequence &&other) {
+        spliceAfter(position, other);
+    }
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+// Файл, отображённый в память только для чтения
+class MappedFile {
+private:
+    const char *ptr;
+    size_t length;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+
+    void release() {
+#ifdef _WIN32
+        if (ptr) UnmapViewOfFile(ptr);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+        mapping = nullptr;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (ptr) munmap(const_cast<char *>(ptr), length);
+#endif
+        ptr = nullptr;
+        length = 0;
+    }
+
+public:
+    explicit MappedFile(const std::string &path) : ptr(nullptr), length(0) {
+#ifdef _WIN32
+        mapping = nullptr;
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                           FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Cannot open file: " + path);
+        }
+        LARGE_INTEGER file_size;
+        GetFileSizeEx(file, &file_size);
+        length = static_cast<size_t>(file_size.QuadPart);
+        if (length) {
+            mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            ptr = mapping ? static_cast<const char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+            if (!ptr) {
+                release();
+                throw std::runtime_error("Cannot map file: " + path);
+            }
+        }
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open file: " + path);
+        }
+        struct stat info{};
+        if (fstat(fd, &info) != 0) {
+            close(fd);
+            throw std::runtime_error("Cannot stat file: " + path);
+        }
+        length = static_cast<size_t>(info.st_size);
+        if (length) {
+            void *mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED) {
+                close(fd);
+                throw std::runtime_error("Cannot map file: " + path);
+            }
+            ptr = static_cast<const char *>(mapped);
+        }
+        close(fd);
+#endif
+    }
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept : ptr(other.ptr), length(other.length) {
+#ifdef _WIN32
+        file = other.file;
+        mapping = other.mapping;
+        other.file = INVALID_HANDLE_VALUE;
+        other.mapping = nullptr;
+#endif
+        other.ptr = nullptr;
+        other.length = 0;
+    }
+
+    ~MappedFile() {
+        release();
+    }
+
+    const char *data() const {
+        return ptr;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return length;
+    }
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// Число потоков: 0 означает "по числу ядер"
+inline unsigned resolveThreadCount(unsigned requested) {
+    if (requested) {
+        return requested;
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Выполняет func(i) для i в [0, count) на пуле потоков с динамической раздачей индексов.
+// Первое выброшенное исключение пробрасывается после завершения всех потоков.
+template<typename Func>
+void parallelFor(size_t count, unsigned threads, Func func) {
+    unsigned workers = std::min<size_t>(resolveThreadCount(threads), count);
+    if (workers <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next(0);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto worker = [&]() {
+        try {
+            for (size_t i = next++; i < count; i = next++) {
+                func(i);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            next = count;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < workers; ++t) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread: pool) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
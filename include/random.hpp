@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+
+// Финализатор SplitMix64
+inline uint64_t mix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Преобразования 64-битного потока в диапазоны. Не используют std::*_distribution,
+// чьи алгоритмы зависят от реализации библиотеки, поэтому результат одинаков на всех платформах.
+template<typename Derived>
+class RandomDraws {
+public:
+    // Равномерное целое в [0, bound) без смещения по модулю
+    uint64_t uniformIndex(uint64_t bound) {
+        if (bound == 0) {
+            throw std::invalid_argument("Bound must be positive");
+        }
+        uint64_t threshold = (0 - bound) % bound;
+        uint64_t value = self().next();
+        while (value < threshold) {
+            value = self().next();
+        }
+        return value % bound;
+    }
+
+    int uniformInt(int min, int max) {
+        uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+        return static_cast<int>(min + static_cast<int64_t>(uniformIndex(range)));
+    }
+
+    // Равномерное вещественное в [0, 1)
+    double uniformReal() {
+        return static_cast<double>(self().next() >> 11) * 0x1.0p-53;
+    }
+
+private:
+    Derived &self() {
+        return static_cast<Derived &>(*this);
+    }
+};
+
+// Счётчиковый генератор: i-е значение зависит только от (seed, stream, i).
+// Потокам не нужно общее состояние, и результат не зависит от числа потоков.
+class CounterRng : public RandomDraws<CounterRng> {
+private:
+    uint64_t key;
+    uint64_t counter;
+
+public:
+    CounterRng(uint64_t seed, uint64_t stream) : key(mix64(seed ^ mix64(stream))), counter(0) {}
+
+    uint64_t next() {
+        return mix64(key + 0x9E3779B97F4A7C15ULL * ++counter);
+    }
+};
+
+// xoshiro256** (Blackman, Vigna): быстрее mt19937 и с состоянием в 32 байта
+class Xoshiro256StarStar {
+private:
+    uint64_t state[4];
+
+    static uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+public:
+    using result_type = uint64_t;
+
+    explicit Xoshiro256StarStar(uint64_t seed) {
+        for (auto &word: state) {
+            seed += 0x9E3779B97F4A7C15ULL;
+            word = mix64(seed);
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+
+    static constexpr result_type max() { return UINT64_MAX; }
+
+    result_type operator()() {
+        uint64_t result = rotl(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+};
+
+enum class RngEngine {
+    Mt19937,
+    Xoshiro256
+};
+
+inline RngEngine parseRngEngine(const std::string &name) {
+    if (name == "mt") {
+        return RngEngine::Mt19937;
+    } else if (name == "xoshiro") {
+        return RngEngine::Xoshiro256;
+    }
+    throw std::invalid_argument("Unknown RNG engine: " + name);
+}
+
+inline std::string rngEngineName(RngEngine engine) {
+    return engine == RngEngine::Mt19937 ? "mt" : "xoshiro";
+}
+
+// Последовательный генератор с выбираемым движком.
+// Оба движка полностью определены стандартом/алгоритмом, так что поток бит воспроизводим.
+class RandomEngine : public RandomDraws<RandomEngine> {
+private:
+    RngEngine engine;
+    std::mt19937_64 mt;
+    Xoshiro256StarStar xoshiro;
+
+public:
+    RandomEngine(RngEngine engine, uint64_t seed)
+            : engine(engine), mt(engine == RngEngine::Mt19937 ? seed : 0), xoshiro(seed) {}
+
+    uint64_t next() {
+        return engine == RngEngine::Mt19937 ? mt() : xoshiro();
+    }
+};
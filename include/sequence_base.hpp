@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+
+
+// CRTP-база семейства последовательностей (Sequence, ArraySequence, ListSequence).
+// Наследник хранит только свои данные и реализует add/remove/get/getSize без virtual,
+// поэтому вызовы в циклах встраиваются. Общие операции выражены через методы наследника.
+// Для полиморфизма во время выполнения - адаптер SequenceRef (sequence_ref.hpp).
+template<typename Derived, typename T>
+class SequenceBase {
+private:
+    Derived &derived() {
+        return static_cast<Derived &>(*this);
+    }
+
+    const Derived &derived() const {
+        return static_cast<const Derived &>(*this);
+    }
+
+protected:
+    SequenceBase() = default;
+
+    ~SequenceBase() = default;
+
+public:
+    using value_type = T;
+
+    Derived &operator+=(const T &element) {
+        derived().add(element);
+        return derived();
+    }
+
+    bool operator!=(const Derived &other) const {
+        return !(derived() == other);
+    }
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+
+// Невладеющий адаптер со стиранием типа: любая последовательность (Sequence, ArraySequence,
+// ListSequence, ...) передаётся туда, где нужен полиморфизм во время выполнения (ISorter).
+// Таблица операций одна на тип последовательности; сами классы остаются без vtable.
+template<typename T>
+class SequenceRef {
+private:
+    struct Operations {
+        void (*add)(void *, const T &);
+        void (*remove)(void *, size_t);
+        T &(*get)(void *, size_t);
+        size_t (*getSize)(const void *);
+        T *(*contiguousData)(void *);
+    };
+
+    template<typename S>
+    static constexpr Operations operations_for = {
+            [](void *sequence, const T &element) { static_cast<S *>(sequence)->add(element); },
+            [](void *sequence, size_t index) { static_cast<S *>(sequence)->remove(index); },
+            [](void *sequence, size_t index) -> T & { return static_cast<S *>(sequence)->get(index); },
+            [](const void *sequence) -> size_t { return static_cast<const S *>(sequence)->getSize(); },
+            [](void *sequence) -> T * { return static_cast<S *>(sequence)->contiguousData(); }
+    };
+
+    void *sequence;
+    const Operations *operations;
+
+public:
+    using value_type = T;
+
+    template<typename S, typename = std::enable_if_t<!std::is_same_v<std::decay_t<S>, SequenceRef>>>
+    SequenceRef(S &sequence) : sequence(&sequence), operations(&operations_for<S>) {}
+
+    void add(const T &element) {
+        operations->add(sequence, element);
+    }
+
+    void remove(size_t index) {
+        operations->remove(sequence, index);
+    }
+
+    T &get(size_t index) const {
+        return operations->get(sequence, index);
+    }
+
+    [[nodiscard]] size_t getSize() const {
+        return operations->getSize(sequence);
+    }
+
+    // Непрерывный буфер элементов, nullptr - если элементы хранятся не подряд
+    T *contiguousData() const {
+        return operations->contiguousData(sequence);
+    }
+};
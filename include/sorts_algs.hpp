@@ -1,48 +1,872 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "comparators.hpp"
-#include "sequence.hpp"
+#include "parallel.hpp"
+#include "sequence_ref.hpp"
 
 
+// Вызывает func(begin, end) на непрерывном буфере последовательности.
+// Если буфера нет (список) - обрабатывает копию и записывает её обратно.
+template<typename Seq, typename Func>
+void withContiguous(Seq &seq, Func func) {
+    using T = typename Seq::value_type;
+    size_t size = seq.getSize();
+    if (size < 2) return;
+    if (T *data = seq.contiguousData()) {
+        func(data, data + size);
+        return;
+    }
+    std::vector<T> buffer;
+    buffer.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        buffer.push_back(std::move(seq.get(i)));
+    }
+    func(buffer.data(), buffer.data() + size);
+    for (size_t i = 0; i < size; ++i) {
+        seq.get(i) = std::move(buffer[i]);
+    }
+}
+
 template<typename T>
 class ISorter {
 public:
-    virtual void sort(Sequence<T> &seq, bool (compareFunc)(const T &, const T &)) const {}
+    virtual void sort(SequenceRef<T> seq, bool (compareFunc)(const T &, const T &)) const {}
     virtual ~ISorter() = default;
+
 };
 
 
 template<typename T>
 class QuickSort : public ISorter<T> {
 private:
-    void quickSortInside(Sequence<T> &seq, int low, int high, bool (compareFunc)(const T &, const T &)) const {
+    void quickSortInside(T *data, int low, int high, bool (compareFunc)(const T &, const T &)) const {
         if (low < high) {
             int pivot = high;
 
             int i = (low - 1);
             for (int j = low; j <= high - 1; ++j) {
-                if (compareFunc(seq.get(j), seq.get(pivot))) {
+                if (compareFunc(data[j], data[pivot])) {
                     ++i;
-                    std::swap(seq.get(i), seq.get(j));
+                    std::swap(data[i], data[j]);
+                }
+            }
+            std::swap(data[i + 1], data[high]);
+
+            quickSortInside(data, low, i, compareFunc);
+            quickSortInside(data, i + 2, high, compareFunc);
+        }
+    }
+
+public:
+    void sort(SequenceRef<T> seq, bool (compareFunc)(const T &, const T &)) const override {
+        withContiguous(seq, [this, compareFunc](T *begin, T *end) {
+            int size = static_cast<int>(end - begin);
+            bool flag = true;
+            for (int i = 0; i < size - 1; ++i) {
+                if (compareFunc(begin[i + 1], begin[i])) flag = false;
+            }
+            if (flag) return;
+
+            quickSortInside(begin, 0, size - 1, compareFunc);
+        });
+    }
+};
+
+// Pattern-defeating quicksort (по алгоритму pdqsort, O. Peters): интроспективная сортировка
+// с медианой из трёх/девяти, вставками на коротких отрезках, блочным разбиением без ветвлений,
+// перемешиванием при неудачных опорных и пирамидальной сортировкой как гарантией O(n log n).
+// Работает напрямую с указателями на непрерывный буфер последовательности.
+template<typename T>
+class PdqSort : public ISorter<T> {
+private:
+    static constexpr ptrdiff_t insertion_sort_threshold = 24;
+    static constexpr ptrdiff_t ninther_threshold = 128;
+    static constexpr ptrdiff_t partial_insertion_limit = 8;
+    static constexpr size_t block_size = 64;
+
+    template<typename Compare>
+    static void insertionSort(T *begin, T *end, Compare &comp) {
+        if (begin == end) return;
+        for (T *cur = begin + 1; cur != end; ++cur) {
+            T *sift = cur;
+            T *sift_1 = cur - 1;
+            if (comp(*sift, *sift_1)) {
+                T tmp = std::move(*sift);
+                do {
+                    *sift-- = std::move(*sift_1);
+                } while (sift != begin && comp(tmp, *--sift_1));
+                *sift = std::move(tmp);
+            }
+        }
+    }
+
+    // Без проверки левой границы: слева от begin лежит элемент, не больший любого в отрезке
+    template<typename Compare>
+    static void unguardedInsertionSort(T *begin, T *end, Compare &comp) {
+        if (begin == end) return;
+        for (T *cur = begin + 1; cur != end; ++cur) {
+            T *sift = cur;
+            T *sift_1 = cur - 1;
+            if (comp(*sift, *sift_1)) {
+                T tmp = std::move(*sift);
+                do {
+                    *sift-- = std::move(*sift_1);
+                } while (comp(tmp, *--sift_1));
+                *sift = std::move(tmp);
+            }
+        }
+    }
+
+    // Вставки с ограничением на число перемещений; false - отрезок далёк от отсортированного
+    template<typename Compare>
+    static bool partialInsertionSort(T *begin, T *end, Compare &comp) {
+        if (begin == end) return true;
+        ptrdiff_t moved = 0;
+        for (T *cur = begin + 1; cur != end; ++cur) {
+            T *sift = cur;
+            T *sift_1 = cur - 1;
+            if (comp(*sift, *sift_1)) {
+                T tmp = std::move(*sift);
+                do {
+                    *sift-- = std::move(*sift_1);
+                } while (sift != begin && comp(tmp, *--sift_1));
+                *sift = std::move(tmp);
+                moved += cur - sift;
+                if (moved > partial_insertion_limit) return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename Compare>
+    static void siftDown(T *heap, ptrdiff_t size, ptrdiff_t root, Compare &comp) {
+        T value = std::move(heap[root]);
+        ptrdiff_t child;
+        while ((child = 2 * root + 1) < size) {
+            if (child + 1 < size && comp(heap[child], heap[child + 1])) ++child;
+            if (!comp(value, heap[child])) break;
+            heap[root] = std::move(heap[child]);
+            root = child;
+        }
+        heap[root] = std::move(value);
+    }
+
+    template<typename Compare>
+    static void heapSort(T *begin, T *end, Compare &comp) {
+        ptrdiff_t size = end - begin;
+        for (ptrdiff_t i = size / 2; i-- > 0;) {
+            siftDown(begin, size, i, comp);
+        }
+        for (ptrdiff_t last = size - 1; last > 0; --last) {
+            std::swap(begin[0], begin[last]);
+            siftDown(begin, last, 0, comp);
+        }
+    }
+
+    // Оставляет в [begin, middle) middle - begin наименьших элементов в виде max-кучи
+    template<typename Compare>
+    static void heapSelect(T *begin, T *middle, T *end, Compare &comp) {
+        ptrdiff_t size = middle - begin;
+        for (ptrdiff_t i = size / 2; i-- > 0;) {
+            siftDown(begin, size, i, comp);
+        }
+        for (T *it = middle; it != end; ++it) {
+            if (comp(*it, *begin)) {
+                std::swap(*it, *begin);
+                siftDown(begin, size, 0, comp);
+            }
+        }
+    }
+
+    template<typename Compare>
+    static void sort2(T *a, T *b, Compare &comp) {
+        if (comp(*b, *a)) std::swap(*a, *b);
+    }
+
+    template<typename Compare>
+    static void sort3(T *a, T *b, T *c, Compare &comp) {
+        sort2(a, b, comp);
+        sort2(b, c, comp);
+        sort2(a, b, comp);
+    }
+
+    // Обмен найденных в блоках пар; при num_l != num_r - циклическим сдвигом, это дешевле swap
+    static void swapOffsets(T *first, T *last, const unsigned char *offsets_l, const unsigned char *offsets_r,
+                            size_t num, bool use_swaps) {
+        if (use_swaps) {
+            for (size_t i = 0; i < num; ++i) {
+                std::swap(first[offsets_l[i]], *(last - offsets_r[i]));
+            }
+        } else if (num > 0) {
+            T *l = first + offsets_l[0];
+            T *r = last - offsets_r[0];
+            T tmp(std::move(*l));
+            *l = std::move(*r);
+            for (size_t i = 1; i < num; ++i) {
+                l = first + offsets_l[i];
+                *r = std::move(*l);
+                r = last - offsets_r[i];
+                *l = std::move(*r);
+            }
+            *r = std::move(tmp);
+        }
+    }
+
+    // Разбиение вокруг *begin: элементы < опорного слева, >= справа. Сравнения копятся в блоках
+    // смещений, а условных переходов, зависящих от данных, нет (BlockQuicksort).
+    // Возвращает позицию опорного и признак того, что отрезок уже был разбит.
+    template<typename Compare>
+    static std::pair<T *, bool> partitionRightBranchless(T *begin, T *end, Compare &comp) {
+        T pivot(std::move(*begin));
+        T *first = begin;
+        T *last = end;
+
+        while (comp(*++first, pivot));
+        if (first - 1 == begin) {
+            while (first < last && !comp(*--last, pivot));
+        } else {
+            while (!comp(*--last, pivot));
+        }
+
+        bool already_partitioned = first >= last;
+        if (!already_partitioned) {
+            std::swap(*first, *last);
+            ++first;
+
+            unsigned char offsets_l_storage[block_size];
+            unsigned char offsets_r_storage[block_size];
+            unsigned char *offsets_l = offsets_l_storage;
+            unsigned char *offsets_r = offsets_r_storage;
+            T *offsets_l_base = first;
+            T *offsets_r_base = last;
+            size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+            while (first < last) {
+                size_t num_unknown = last - first;
+                size_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+                size_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+                size_t left_count = std::min(left_split, block_size);
+                for (size_t i = 0; i < left_count; ++i) {
+                    offsets_l[num_l] = static_cast<unsigned char>(i);
+                    num_l += !comp(*first, pivot);
+                    ++first;
+                }
+                size_t right_count = std::min(right_split, block_size);
+                for (size_t i = 0; i < right_count; ++i) {
+                    offsets_r[num_r] = static_cast<unsigned char>(i + 1);
+                    num_r += comp(*--last, pivot);
+                }
+
+                size_t num = std::min(num_l, num_r);
+                swapOffsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r,
+                            num, num_l == num_r);
+                num_l -= num;
+                num_r -= num;
+                start_l += num;
+                start_r += num;
+                if (num_l == 0) {
+                    start_l = 0;
+                    offsets_l_base = first;
+                }
+                if (num_r == 0) {
+                    start_r = 0;
+                    offsets_r_base = last;
+                }
+            }
+
+            // Остатки незакрытого блока переносятся к границе разбиения
+            if (num_l) {
+                offsets_l += start_l;
+                while (num_l--) std::swap(offsets_l_base[offsets_l[num_l]], *--last);
+                first = last;
+            }
+            if (num_r) {
+                offsets_r += start_r;
+                while (num_r--) std::swap(*(offsets_r_base - offsets_r[num_r]), *first), ++first;
+                last = first;
+            }
+        }
+
+        T *pivot_pos = first - 1;
+        *begin = std::move(*pivot_pos);
+        *pivot_pos = std::move(pivot);
+        return {pivot_pos, already_partitioned};
+    }
+
+    // То же разбиение с обычными ветвлениями - для дорогих в перемещении типов
+    template<typename Compare>
+    static std::pair<T *, bool> partitionRight(T *begin, T *end, Compare &comp) {
+        T pivot(std::move(*begin));
+        T *first = begin;
+        T *last = end;
+
+        while (comp(*++first, pivot));
+        if (first - 1 == begin) {
+            while (first < last && !comp(*--last, pivot));
+        } else {
+            while (!comp(*--last, pivot));
+        }
+
+        bool already_partitioned = first >= last;
+        while (first < last) {
+            std::swap(*first, *last);
+            while (comp(*++first, pivot));
+            while (!comp(*--last, pivot));
+        }
+
+        T *pivot_pos = first - 1;
+        *begin = std::move(*pivot_pos);
+        *pivot_pos = std::move(pivot);
+        return {pivot_pos, already_partitioned};
+    }
+
+    // Элементы, равные опорному, уходят влево; используется при многих повторах
+    template<typename Compare>
+    static T *partitionLeft(T *begin, T *end, Compare &comp) {
+        T pivot(std::move(*begin));
+        T *first = begin;
+        T *last = end;
+
+        while (comp(pivot, *--last));
+        if (last + 1 == end) {
+            while (first < last && !comp(pivot, *++first));
+        } else {
+            while (!comp(pivot, *++first));
+        }
+
+        while (first < last) {
+            std::swap(*first, *last);
+            while (comp(pivot, *--last));
+            while (!comp(pivot, *++first));
+        }
+
+        T *pivot_pos = last;
+        *begin = std::move(*pivot_pos);
+        *pivot_pos = std::move(pivot);
+        return pivot_pos;
+    }
+
+    template<bool Branchless, typename Compare>
+    static void sortLoop(T *begin, T *end, Compare &comp, int bad_allowed, bool leftmost) {
+        while (true) {
+            ptrdiff_t size = end - begin;
+            if (size < insertion_sort_threshold) {
+                if (leftmost) {
+                    insertionSort(begin, end, comp);
+                } else {
+                    unguardedInsertionSort(begin, end, comp);
+                }
+                return;
+            }
+
+            // Опорный - медиана трёх, на больших отрезках - псевдомедиана девяти (ninther)
+            ptrdiff_t half = size / 2;
+            if (size > ninther_threshold) {
+                sort3(begin, begin + half, end - 1, comp);
+                sort3(begin + 1, begin + (half - 1), end - 2, comp);
+                sort3(begin + 2, begin + (half + 1), end - 3, comp);
+                sort3(begin + (half - 1), begin + half, begin + (half + 1), comp);
+                std::swap(*begin, *(begin + half));
+            } else {
+                sort3(begin + half, begin, end - 1, comp);
+            }
+
+            // Опорный равен элементу перед отрезком - все равные ему можно не сортировать дальше
+            if (!leftmost && !comp(*(begin - 1), *begin)) {
+                begin = partitionLeft(begin, end, comp) + 1;
+                continue;
+            }
+
+            std::pair<T *, bool> part = Branchless ? partitionRightBranchless(begin, end, comp)
+                                                   : partitionRight(begin, end, comp);
+            T *pivot_pos = part.first;
+            ptrdiff_t l_size = pivot_pos - begin;
+            ptrdiff_t r_size = end - (pivot_pos + 1);
+
+            if (l_size < size / 8 || r_size < size / 8) {
+                // Слишком много неудачных разбиений - переходим на пирамидальную сортировку
+                if (--bad_allowed == 0) {
+                    heapSort(begin, end, comp);
+                    return;
+                }
+                // Иначе ломаем шаблон входных данных, переставив несколько элементов
+                if (l_size >= insertion_sort_threshold) {
+                    std::swap(*begin, *(begin + l_size / 4));
+                    std::swap(*(pivot_pos - 1), *(pivot_pos - l_size / 4));
+                    if (l_size > ninther_threshold) {
+                        std::swap(*(begin + 1), *(begin + (l_size / 4 + 1)));
+                        std::swap(*(begin + 2), *(begin + (l_size / 4 + 2)));
+                        std::swap(*(pivot_pos - 2), *(pivot_pos - (l_size / 4 + 1)));
+                        std::swap(*(pivot_pos - 3), *(pivot_pos - (l_size / 4 + 2)));
+                    }
+                }
+                if (r_size >= insertion_sort_threshold) {
+                    std::swap(*(pivot_pos + 1), *(pivot_pos + (1 + r_size / 4)));
+                    std::swap(*(end - 1), *(end - r_size / 4));
+                    if (r_size > ninther_threshold) {
+                        std::swap(*(pivot_pos + 2), *(pivot_pos + (2 + r_size / 4)));
+                        std::swap(*(pivot_pos + 3), *(pivot_pos + (3 + r_size / 4)));
+                        std::swap(*(end - 2), *(end - (1 + r_size / 4)));
+                        std::swap(*(end - 3), *(end - (2 + r_size / 4)));
+                    }
+                }
+            } else if (part.second && partialInsertionSort(begin, pivot_pos, comp) &&
+                       partialInsertionSort(pivot_pos + 1, end, comp)) {
+                // Отрезок уже был разбит и обе части почти отсортированы
+                return;
+            }
+
+            // Рекурсия в левую часть, правая - в цикле
+            sortLoop<Branchless>(begin, pivot_pos, comp, bad_allowed, leftmost);
+            begin = pivot_pos + 1;
+            leftmost = false;
+        }
+    }
+
+public:
+    // Introselect: ставит на место nth тот элемент, что стоял бы там после сортировки;
+    // слева от него - не большие, справа - не меньшие. O(n) в среднем, худший случай
+    // ограничен переходом на отбор кучей после log2(n) неудачных разбиений.
+    template<typename Compare>
+    static void selectRange(T *begin, T *nth, T *end, Compare comp) {
+        if (nth >= end || end - begin < 2) return;
+        int bad_allowed = 0;
+        for (ptrdiff_t size = end - begin; size >>= 1;) ++bad_allowed;
+
+        while (end - begin > insertion_sort_threshold) {
+            ptrdiff_t size = end - begin;
+            ptrdiff_t half = size / 2;
+            if (size > ninther_threshold) {
+                sort3(begin, begin + half, end - 1, comp);
+                sort3(begin + 1, begin + (half - 1), end - 2, comp);
+                sort3(begin + 2, begin + (half + 1), end - 3, comp);
+                sort3(begin + (half - 1), begin + half, begin + (half + 1), comp);
+                std::swap(*begin, *(begin + half));
+            } else {
+                sort3(begin + half, begin, end - 1, comp);
+            }
+
+            T *pivot_pos = partitionRight(begin, end, comp).first;
+            ptrdiff_t l_size = pivot_pos - begin;
+            ptrdiff_t r_size = end - (pivot_pos + 1);
+            if ((l_size < size / 8 || r_size < size / 8) && --bad_allowed == 0) {
+                heapSelect(begin, nth + 1, end, comp);
+                std::swap(*begin, *nth);
+                return;
+            }
+
+            if (nth == pivot_pos) {
+                return;
+            } else if (nth < pivot_pos) {
+                end = pivot_pos;
+            } else {
+                begin = pivot_pos + 1;
+            }
+        }
+        insertionSort(begin, end, comp);
+    }
+
+    // Сортирует только [begin, middle): наименьшие middle - begin элементов по порядку
+    template<typename Compare>
+    static void partialSortRange(T *begin, T *middle, T *end, Compare comp) {
+        if (middle <= begin) return;
+        if (middle < end) {
+            selectRange(begin, middle - 1, end, comp);
+        }
+        sortRange(begin, std::min(middle, end), comp);
+    }
+
+    template<typename Compare>
+    static void sortRange(T *begin, T *end, Compare comp) {
+        ptrdiff_t size = end - begin;
+        if (size < 2) return;
+        int bad_allowed = 0;
+        while (size >>= 1) ++bad_allowed;
+        sortLoop<std::is_trivially_copyable_v<T>>(begin, end, comp, bad_allowed, true);
+    }
+
+    void sort(SequenceRef<T> seq, bool (compareFunc)(const T &, const T &)) const override {
+        sort<SequenceRef<T>, bool (*)(const T &, const T &)>(seq, compareFunc);
+    }
+
+    // Шаблонный путь: компаратор известен при компиляции и встраивается в сортировку
+    template<typename Seq, typename Compare>
+    void sort(Seq &seq, Compare comp) const {
+        withContiguous(seq, [&comp](T *begin, T *end) {
+            sortRange(begin, end, comp);
+        });
+    }
+};
+
+
+// Ключ поразрядной сортировки: само число, для рёбер - вес
+template<typename T>
+struct RadixKey {
+    T operator()(const T &value) const {
+        return value;
+    }
+};
+
+template<typename V>
+struct RadixKey<Edge<V>> {
+    int operator()(const Edge<V> &edge) const {
+        return edge.weight;
+    }
+};
+
+// Поразрядная LSD-сортировка по целочисленному ключу (устойчивая). Элементы перемещаются целиком,
+// сравниваются только ключи. Разряды по 8 бит, на больших массивах - по 11 (3 прохода на 32 бита);
+// проходы считаются по диапазону max - min, а разряд, одинаковый у всех элементов, пропускается.
+// При малом диапазоне ключей - один проход сортировки подсчётом.
+// Порядок задаётся тегом ascending/descending: для убывания ключ инвертируется, поэтому сортировка
+// остаётся устойчивой. Произвольный компаратор не поддерживается, поэтому интерфейса ISorter у неё нет.
+template<typename T, typename Key = RadixKey<T>>
+class RadixSort {
+private:
+    using key_type = std::decay_t<std::invoke_result_t<const Key &, const T &>>;
+    static_assert(std::is_integral_v<key_type>, "RadixSort needs an integral key");
+
+    static constexpr size_t small_size = 64;           // Ниже - сортировка вставками
+    static constexpr size_t wide_digit_size = 1 << 16; // Начиная с этого размера - разряды по 11 бит
+    static constexpr uint64_t counting_sort_range = 1 << 16;
+
+    Key key;
+    bool use_counting_sort;
+
+    // Беззнаковое представление с тем же порядком: у знаковых инвертируется старший бит,
+    // для убывания - все биты
+    template<typename Order>
+    uint64_t orderedKey(const T &value) const {
+        using unsigned_key = std::make_unsigned_t<key_type>;
+        auto bits = static_cast<unsigned_key>(std::invoke(key, value));
+        if constexpr (std::is_signed_v<key_type>) {
+            bits ^= unsigned_key(1) << (sizeof(key_type) * 8 - 1);
+        }
+        if constexpr (std::is_same_v<Order, Descending>) {
+            bits = static_cast<unsigned_key>(~bits);
+        }
+        return bits;
+    }
+
+    template<typename Order>
+    void insertionSort(T *begin, T *end) const {
+        for (T *cur = begin + 1; cur < end; ++cur) {
+            uint64_t cur_key = orderedKey<Order>(*cur);
+            if (cur_key < orderedKey<Order>(*(cur - 1))) {
+                T tmp = std::move(*cur);
+                T *sift = cur;
+                do {
+                    *sift = std::move(*(sift - 1));
+                    --sift;
+                } while (sift != begin && cur_key < orderedKey<Order>(*(sift - 1)));
+                *sift = std::move(tmp);
+            }
+        }
+    }
+
+    template<typename Order>
+    void countingSort(T *begin, T *end, uint64_t min, uint64_t range) const {
+        size_t size = end - begin;
+        std::vector<size_t> counts(range + 2, 0);
+        for (T *it = begin; it != end; ++it) {
+            ++counts[orderedKey<Order>(*it) - min + 1];
+        }
+        for (size_t i = 1; i < counts.size(); ++i) {
+            counts[i] += counts[i - 1];
+        }
+        std::vector<T> buffer(size);
+        for (T *it = begin; it != end; ++it) {
+            buffer[counts[orderedKey<Order>(*it) - min]++] = std::move(*it);
+        }
+        std::move(buffer.begin(), buffer.end(), begin);
+    }
+
+    template<typename Order>
+    void lsdSort(T *begin, T *end, uint64_t min, uint64_t range) const {
+        size_t size = end - begin;
+        unsigned digit_bits = size >= wide_digit_size ? 11 : 8;
+        size_t radix = size_t(1) << digit_bits;
+        uint64_t mask = radix - 1;
+        unsigned key_bits = 0;
+        while (key_bits < 64 && (range >> key_bits) != 0) ++key_bits;
+        unsigned passes = (key_bits + digit_bits - 1) / digit_bits;
+
+        // Гистограммы всех разрядов за один проход по данным
+        std::vector<size_t> counts(passes * radix, 0);
+        for (T *it = begin; it != end; ++it) {
+            uint64_t value = orderedKey<Order>(*it) - min;
+            for (unsigned pass = 0; pass < passes; ++pass) {
+                ++counts[pass * radix + ((value >> (pass * digit_bits)) & mask)];
+            }
+        }
+
+        std::vector<T> buffer(size);
+        T *src = begin;
+        T *dst = buffer.data();
+        for (unsigned pass = 0; pass < passes; ++pass) {
+            size_t *offsets = counts.data() + pass * radix;
+            unsigned shift = pass * digit_bits;
+            if (offsets[((orderedKey<Order>(*src) - min) >> shift) & mask] == size) {
+                continue;
+            }
+            size_t sum = 0;
+            for (size_t digit = 0; digit < radix; ++digit) {
+                size_t count = offsets[digit];
+                offsets[digit] = sum;
+                sum += count;
+            }
+            for (T *it = src; it != src + size; ++it) {
+                dst[offsets[((orderedKey<Order>(*it) - min) >> shift) & mask]++] = std::move(*it);
+            }
+            std::swap(src, dst);
+        }
+        if (src != begin) {
+            std::move(src, src + size, begin);
+        }
+    }
+
+public:
+    explicit RadixSort(Key key = Key(), bool use_counting_sort = true)
+            : key(key), use_counting_sort(use_counting_sort) {}
+
+    template<typename Order = Ascending>
+    void sortRange(T *begin, T *end, Order = Order()) const {
+        static_assert(std::is_same_v<Order, Ascending> || std::is_same_v<Order, Descending>,
+                      "RadixSort order must be ascending or descending");
+        size_t size = end - begin;
+        if (size < small_size) {
+            if (size > 1) insertionSort<Order>(begin, end);
+            return;
+        }
+        uint64_t min = orderedKey<Order>(*begin);
+        uint64_t max = min;
+        uint64_t prev = min;
+        bool sorted = true;
+        for (T *it = begin + 1; it != end; ++it) {
+            uint64_t value = orderedKey<Order>(*it);
+            if (value < min) min = value;
+            if (value > max) max = value;
+            sorted &= prev <= value;
+            prev = value;
+        }
+        uint64_t range = max - min;
+        if (sorted) return;
+        if (use_counting_sort && range < counting_sort_range && range <= size) {
+            countingSort<Order>(begin, end, min, range);
+        } else {
+            lsdSort<Order>(begin, end, min, range);
+        }
+    }
+
+    template<typename Order = Ascending>
+    void sort(SequenceRef<T> seq, Order order = Order()) const {
+        withContiguous(seq, [this, order](T *begin, T *end) {
+            sortRange(begin, end, order);
+        });
+    }
+};
+
+
+// Параллельная сортировка слиянием: массив делится на куски по числу потоков, куски сортируются
+// независимо (PdqSort или, для устойчивой сортировки, std::stable_sort), затем сливаются попарно.
+// Каждое слияние тоже делится между потоками: границы частей ищутся бинарным поиском по
+// диагоналям слияния (merge path), поэтому и последние раунды загружают все ядра.
+template<typename T>
+class ParallelSort : public ISorter<T> {
+private:
+    unsigned threads;
+    size_t cutoff;
+    bool stable;
+
+    struct Run {
+        size_t begin;
+        size_t end;
+    };
+
+    // Сколько элементов a попадает в первые diagonal элементов слияния a и b (при равенстве первым идёт a)
+    template<typename Compare>
+    static size_t mergePathSplit(const T *a, size_t a_size, const T *b, size_t b_size, size_t diagonal,
+                                 Compare &comp) {
+        size_t low = diagonal > b_size ? diagonal - b_size : 0;
+        size_t high = std::min(diagonal, a_size);
+        while (low < high) {
+            size_t i = low + (high - low) / 2;
+            if (!comp(b[diagonal - i - 1], a[i])) {
+                low = i + 1;
+            } else {
+                high = i;
+            }
+        }
+        return low;
+    }
+
+public:
+    explicit ParallelSort(unsigned threads = 0, size_t cutoff = 1 << 16, bool stable = false)
+            : threads(threads), cutoff(std::max<size_t>(cutoff, 1)), stable(stable) {}
+
+    template<typename Compare>
+    void sortRange(T *begin, T *end, Compare comp) const {
+        size_t size = end - begin;
+        unsigned workers = resolveThreadCount(threads);
+        size_t run_count = std::min<size_t>(workers, (size + cutoff - 1) / cutoff);
+        if (run_count <= 1) {
+            if (stable) {
+                std::stable_sort(begin, end, comp);
+            } else {
+                PdqSort<T>::sortRange(begin, end, comp);
+            }
+            return;
+        }
+
+        std::vector<Run> runs(run_count);
+        for (size_t i = 0; i < run_count; ++i) {
+            runs[i] = {size * i / run_count, size * (i + 1) / run_count};
+        }
+        parallelFor(run_count, workers, [&](size_t i) {
+            if (stable) {
+                std::stable_sort(begin + runs[i].begin, begin + runs[i].end, comp);
+            } else {
+                PdqSort<T>::sortRange(begin + runs[i].begin, begin + runs[i].end, comp);
+            }
+        });
+
+        std::vector<T> buffer(size);
+        T *src = begin;
+        T *dst = buffer.data();
+        size_t part_size = std::max(cutoff, size / workers + 1);
+        while (runs.size() > 1) {
+            // Задачи раунда: (пара кусков, диапазон диагоналей слияния)
+            struct Task {
+                size_t pair;
+                size_t from;
+                size_t to;
+            };
+            std::vector<Run> merged;
+            std::vector<Task> tasks;
+            for (size_t pair = 0; pair * 2 < runs.size(); ++pair) {
+                Run left = runs[pair * 2];
+                Run right = pair * 2 + 1 < runs.size() ? runs[pair * 2 + 1] : Run{left.end, left.end};
+                merged.push_back({left.begin, right.end});
+                size_t length = right.end - left.begin;
+                for (size_t from = 0; from < length; from += part_size) {
+                    tasks.push_back({pair, from, std::min(length, from + part_size)});
                 }
             }
-            std::swap(seq.get(i + 1), seq.get(high));
 
-            quickSortInside(seq, low, i, compareFunc);
-            quickSortInside(seq, i + 2, high, compareFunc);
+            parallelFor(tasks.size(), workers, [&](size_t t) {
+                const Task &task = tasks[t];
+                Run left = runs[task.pair * 2];
+                Run right = task.pair * 2 + 1 < runs.size() ? runs[task.pair * 2 + 1] : Run{left.end, left.end};
+                const T *a = src + left.begin;
+                const T *b = src + right.begin;
+                size_t a_size = left.end - left.begin;
+                size_t b_size = right.end - right.begin;
+                size_t a_from = mergePathSplit(a, a_size, b, b_size, task.from, comp);
+                size_t a_to = mergePathSplit(a, a_size, b, b_size, task.to, comp);
+                std::merge(std::make_move_iterator(src + left.begin + a_from),
+                           std::make_move_iterator(src + left.begin + a_to),
+                           std::make_move_iterator(src + right.begin + (task.from - a_from)),
+                           std::make_move_iterator(src + right.begin + (task.to - a_to)),
+                           dst + left.begin + task.from, comp);
+            });
+
+            runs.swap(merged);
+            std::swap(src, dst);
+        }
+        if (src != begin) {
+            parallelFor((size + part_size - 1) / part_size, workers, [&](size_t part) {
+                size_t from = part * part_size;
+                std::move(src + from, src + std::min(size, from + part_size), begin + from);
+            });
         }
     }
 
+    void sort(SequenceRef<T> seq, bool (compareFunc)(const T &, const T &)) const override {
+        sort<SequenceRef<T>, bool (*)(const T &, const T &)>(seq, compareFunc);
+    }
+
+    template<typename Seq, typename Compare>
+    void sort(Seq &seq, Compare comp) const {
+        withContiguous(seq, [this, &comp](T *begin, T *end) {
+            sortRange(begin, end, comp);
+        });
+    }
+};
+
+
+// k-я порядковая статистика: после вызова seq[k] - элемент, который стоял бы там после сортировки
+template<typename Seq, typename Compare = Ascending>
+void nthElement(Seq &seq, size_t k, Compare comp = Compare()) {
+    using T = typename Seq::value_type;
+    if (k >= seq.getSize()) {
+        throw std::out_of_range("Index out of range");
+    }
+    withContiguous(seq, [k, &comp](T *begin, T *end) {
+        PdqSort<T>::selectRange(begin, begin + k, end, comp);
+    });
+}
+
+// Упорядочивает только первые k элементов (остальные - в произвольном порядке)
+template<typename Seq, typename Compare = Ascending>
+void partialSort(Seq &seq, size_t k, Compare comp = Compare()) {
+    using T = typename Seq::value_type;
+    withContiguous(seq, [k, &comp](T *begin, T *end) {
+        PdqSort<T>::partialSortRange(begin, begin + std::min<size_t>(k, end - begin), end, comp);
+    });
+}
+
+// Потоковый отбор k первых по порядку comp элементов (для Ascending - k наименьших)
+// без хранения всего потока: куча из k элементов, O(log k) на элемент.
+template<typename T, typename Compare = Ascending>
+class TopK {
+private:
+    size_t k;
+    Compare comp;
+    std::vector<T> heap; // max-куча по comp: на вершине - худший из отобранных
+
 public:
-    void sort(Sequence<T> &seq, bool (compareFunc)(const T &, const T &)) const override {
-        if (!seq.getSize()) return;
-        bool flag = true;
-        for (int i = 0; i < seq.getSize() - 1; ++i) {
-            if (compareFunc(seq.get(i + 1), seq.get(i))) flag = false;
+    explicit TopK(size_t k, Compare comp = Compare()) : k(k), comp(comp) {
+        heap.reserve(k);
+    }
+
+    void add(const T &value) {
+        if (heap.size() < k) {
+            heap.push_back(value);
+            std::push_heap(heap.begin(), heap.end(), comp);
+        } else if (k && comp(value, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), comp);
+            heap.back() = value;
+            std::push_heap(heap.begin(), heap.end(), comp);
         }
-        if (flag) return;
+    }
+
+    [[nodiscard]] size_t getSize() const {
+        return heap.size();
+    }
+
+    // Отобранные элементы по порядку comp
+    std::vector<T> result() const {
+        std::vector<T> sorted = heap;
+        std::sort_heap(sorted.begin(), sorted.end(), comp);
+        return sorted;
+    }
+};
 
-        quickSortInside(seq, 0, seq.getSize() - 1, compareFunc);
+template<typename Seq, typename Compare = Ascending>
+std::vector<typename Seq::value_type> topK(const Seq &seq, size_t k, Compare comp = Compare()) {
+    TopK<typename Seq::value_type, Compare> selector(k, comp);
+    for (const auto &value : seq) {
+        selector.add(value);
     }
-};
\ No newline at end of file
+    return selector.result();
+}
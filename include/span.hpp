@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+
+// Проверка индексов в быстрых методах доступа (Sequence::uncheckedAt, Span::operator[]).
+// По умолчанию выключена; для отладочной сборки включается опцией CMake LAB4_CHECKED_ACCESS.
+#ifdef LAB4_CHECKED_ACCESS
+inline constexpr bool checked_access = true;
+#else
+inline constexpr bool checked_access = false;
+#endif
+
+inline void checkIndex(size_t index, size_t size) {
+    if constexpr (checked_access) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+}
+
+
+// Невладеющее представление непрерывного участка памяти (аналог std::span из C++20)
+template<typename T>
+class Span {
+private:
+    T *ptr;
+    size_t count;
+
+public:
+    using value_type = std::remove_cv_t<T>;
+
+    Span() : ptr(nullptr), count(0) {}
+
+    Span(T *ptr, size_t count) : ptr(ptr), count(count) {}
+
+    // Span<T> -> Span<const T>
+    template<typename U, typename = std::enable_if_t<std::is_same_v<const U, T> && !std::is_const_v<U>>>
+    Span(const Span<U> &other) : ptr(other.data()), count(other.size()) {}
+
+    T *data() const {
+        return ptr;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return count;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return count == 0;
+    }
+
+    T &operator[](size_t index) const {
+        checkIndex(index, count);
+        return ptr[index];
+    }
+
+    T *begin() const {
+        return ptr;
+    }
+
+    T *end() const {
+        return ptr + count;
+    }
+
+    Span subspan(size_t offset, size_t length) const {
+        if constexpr (checked_access) {
+            if (offset > count || length > count - offset) {
+                throw std::out_of_range("Subspan out of range");
+            }
+        }
+        return Span(ptr + offset, length);
+    }
+};
@@ -0,0 +1,406 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "sequence_base.hpp"
+
+
+// Развёрнутый список: каждый узел (блок) хранит до ChunkCapacity элементов подряд,
+// поэтому обход идёт по непрерывной памяти и переходит по указателю раз в блок.
+// Заполненность блоков поддерживается не ниже половины (кроме последнего):
+// полный блок при вставке делится пополам, недозаполненный при удалении
+// занимает элемент у соседа или сливается с ним.
+template<typename T, size_t ChunkCapacity = 64>
+class UnrolledListSequence : public SequenceBase<UnrolledListSequence<T, ChunkCapacity>, T> {
+    static_assert(ChunkCapacity >= 2, "chunk must hold at least two elements");
+
+private:
+    static constexpr size_t min_fill = ChunkCapacity / 2;
+
+    struct Chunk {
+        Chunk *prev = nullptr;
+        Chunk *next = nullptr;
+        size_t count = 0;
+        alignas(T) unsigned char storage[sizeof(T) * ChunkCapacity];
+
+        T *items() {
+            return std::launder(reinterpret_cast<T *>(storage));
+        }
+
+        const T *items() const {
+            return std::launder(reinterpret_cast<const T *>(storage));
+        }
+
+        template<typename... Args>
+        T &construct(size_t position, Args &&...args) {
+            return *::new(static_cast<void *>(storage + position * sizeof(T))) T(std::forward<Args>(args)...);
+        }
+
+        void destroyLast() {
+            items()[--count].~T();
+        }
+
+        // Переносит в конец блока number элементов source начиная с first
+        void takeFrom(Chunk *source, size_t first, size_t number) {
+            for (size_t i = 0; i < number; ++i) {
+                construct(count++, std::move(source->items()[first + i]));
+            }
+        }
+
+        ~Chunk() {
+            while (count) {
+                destroyLast();
+            }
+        }
+    };
+
+    Chunk *head;
+    Chunk *tail;
+    size_t size;
+    size_t chunks;
+
+    // Кеш последнего блока, найденного по индексу, и индекс его первого элемента.
+    // Вставка и удаление меняют только этот блок и следующие за ним, поэтому кеш остаётся верным.
+    // Кеш сдвигают только неконстантные методы: const get() его читает, но не меняет
+    Chunk *cursor;
+    size_t cursor_start;
+
+    // Блок, содержащий index, и индекс его первого элемента (start)
+    Chunk *findChunk(size_t index, size_t &start) const {
+        Chunk *current;
+        if (index >= size - tail->count) {
+            current = tail;
+            start = size - tail->count;
+        } else if (cursor && cursor_start <= index) {
+            current = cursor;
+            start = cursor_start;
+        } else {
+            current = head;
+            start = 0;
+        }
+        while (index >= start + current->count) {
+            start += current->count;
+            current = current->next;
+        }
+        return current;
+    }
+
+    // Блок, содержащий index, и смещение в нём; блок запоминается в кеше
+    Chunk *locate(size_t index, size_t &offset) {
+        size_t start;
+        Chunk *current = findChunk(index, start);
+        cursor = current;
+        cursor_start = start;
+        offset = index - start;
+        return current;
+    }
+
+    Chunk *linkAfter(Chunk *chunk) {
+        Chunk *created = new Chunk;
+        created->prev = chunk;
+        created->next = chunk ? chunk->next : head;
+        if (created->next) {
+            created->next->prev = created;
+        } else {
+            tail = created;
+        }
+        if (chunk) {
+            chunk->next = created;
+        } else {
+            head = created;
+        }
+        ++chunks;
+        return created;
+    }
+
+    void unlink(Chunk *chunk) {
+        (chunk->prev ? chunk->prev->next : head) = chunk->next;
+        (chunk->next ? chunk->next->prev : tail) = chunk->prev;
+        delete chunk;
+        --chunks;
+    }
+
+    // Вставка перед index (index == getSize() - в конец)
+    template<typename... Args>
+    T &emplaceAt(size_t index, Args &&...args) {
+        if (index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        if (index == size) {
+            return emplace(std::forward<Args>(args)...);
+        }
+        T element(std::forward<Args>(args)...);
+        size_t offset;
+        Chunk *chunk = locate(index, offset);
+        if (chunk->count == ChunkCapacity) {
+            Chunk *half = linkAfter(chunk);
+            half->takeFrom(chunk, min_fill, ChunkCapacity - min_fill);
+            while (chunk->count > min_fill) {
+                chunk->destroyLast();
+            }
+            if (offset > min_fill) {
+                chunk = half;
+                offset -= min_fill;
+            }
+        }
+        T *items = chunk->items();
+        if (offset == chunk->count) {
+            chunk->construct(chunk->count++, std::move(element));
+        } else {
+            chunk->construct(chunk->count, std::move(items[chunk->count - 1]));
+            std::move_backward(items + offset, items + chunk->count - 1, items + chunk->count);
+            items[offset] = std::move(element);
+            ++chunk->count;
+        }
+        ++size;
+        return items[offset];
+    }
+
+    void rebalance(Chunk *chunk) {
+        if (!chunk->count) {
+            cursor = nullptr;
+            unlink(chunk);
+            return;
+        }
+        Chunk *next = chunk->next;
+        if (chunk->count >= min_fill || !next) {
+            return;
+        }
+        if (chunk->count + next->count <= ChunkCapacity) {
+            chunk->takeFrom(next, 0, next->count);
+            unlink(next);
+        } else {
+            // У соседа больше половины: одного элемента хватает, чтобы оба блока остались заполнены наполовину
+            chunk->takeFrom(next, 0, 1);
+            T *items = next->items();
+            std::move(items + 1, items + next->count, items);
+            next->destroyLast();
+        }
+    }
+
+    void copyFrom(const UnrolledListSequence &other) {
+        for (const Chunk *chunk = other.head; chunk; chunk = chunk->next) {
+            Chunk *copy = linkAfter(tail);
+            for (size_t i = 0; i < chunk->count; ++i) {
+                copy->construct(copy->count++, chunk->items()[i]);
+            }
+            size += chunk->count;
+        }
+    }
+
+    void takeChunks(UnrolledListSequence &other) {
+        head = other.head;
+        tail = other.tail;
+        size = other.size;
+        chunks = other.chunks;
+        cursor = nullptr;
+        other.head = other.tail = nullptr;
+        other.size = other.chunks = 0;
+        other.cursor = nullptr;
+    }
+
+public:
+    UnrolledListSequence() : head(nullptr), tail(nullptr), size(0), chunks(0), cursor(nullptr), cursor_start(0) {}
+
+    UnrolledListSequence(const UnrolledListSequence &other) : UnrolledListSequence() {
+        copyFrom(other);
+    }
+
+    UnrolledListSequence(UnrolledListSequence &&other) noexcept : UnrolledListSequence() {
+        takeChunks(other);
+    }
+
+    ~UnrolledListSequence() {
+        clear();
+    }
+
+    void add(const T &element) {
+        emplace(element);
+    }
+
+    void add(T &&element) {
+        emplace(std::move(element));
+    }
+
+    // Добавление в конец заполняет последний блок целиком
+    template<typename... Args>
+    T &emplace(Args &&...args) {
+        if (!tail || tail->count == ChunkCapacity) {
+            linkAfter(tail);
+        }
+        T &element = tail->construct(tail->count, std::forward<Args>(args)...);
+        ++tail->count;
+        ++size;
+        return element;
+    }
+
+    void insert(size_t index, const T &element) {
+        emplaceAt(index, element);
+    }
+
+    void insert(size_t index, T &&element) {
+        emplaceAt(index, std::move(element));
+    }
+
+    template<typename InputIt>
+    void append(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            emplace(*first);
+        }
+    }
+
+    void remove(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        size_t offset;
+        Chunk *chunk = locate(index, offset);
+        T *items = chunk->items();
+        std::move(items + offset + 1, items + chunk->count, items + offset);
+        chunk->destroyLast();
+        --size;
+        rebalance(chunk);
+    }
+
+    T &get(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        size_t offset;
+        return locate(index, offset)->items()[offset];
+    }
+
+    const T &get(size_t index) const {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        size_t start;
+        return findChunk(index, start)->items()[index - start];
+    }
+
+    [[nodiscard]] size_t getSize() const {
+        return size;
+    }
+
+    [[nodiscard]] size_t getChunkCount() const {
+        return chunks;
+    }
+
+    // Элементы лежат подряд только внутри блока
+    T *contiguousData() {
+        return nullptr;
+    }
+
+    void clear() {
+        while (head) {
+            unlink(head);
+        }
+        size = 0;
+        cursor = nullptr;
+    }
+
+    UnrolledListSequence &operator=(const UnrolledListSequence &other) {
+        if (this != &other) {
+            clear();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    UnrolledListSequence &operator=(UnrolledListSequence &&other) noexcept {
+        if (this != &other) {
+            clear();
+            takeChunks(other);
+        }
+        return *this;
+    }
+
+    bool operator==(const UnrolledListSequence &other) const {
+        return size == other.size && std::equal(begin(), end(), other.begin());
+    }
+
+    template<typename ChunkPointer, typename Reference>
+    class BasicIterator {
+    private:
+        ChunkPointer chunk;
+        size_t offset;
+
+        template<typename, typename>
+        friend class BasicIterator;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::remove_reference_t<Reference> *;
+        using reference = Reference;
+
+        BasicIterator(ChunkPointer chunk, size_t offset) : chunk(chunk), offset(offset) {}
+
+        // ListIterator -> ConstListIterator
+        template<typename OtherPointer, typename OtherReference>
+        BasicIterator(const BasicIterator<OtherPointer, OtherReference> &other) : chunk(other.chunk), offset(other.offset) {}
+
+        reference operator*() const {
+            return chunk->items()[offset];
+        }
+
+        pointer operator->() const {
+            return &chunk->items()[offset];
+        }
+
+        BasicIterator &operator++() {
+            if (++offset == chunk->count) {
+                chunk = chunk->next;
+                offset = 0;
+            }
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const BasicIterator &other) const {
+            return chunk == other.chunk && offset == other.offset;
+        }
+
+        bool operator!=(const BasicIterator &other) const {
+            return !(*this == other);
+        }
+    };
+
+    using ListIterator = BasicIterator<Chunk *, T &>;
+    using ConstListIterator = BasicIterator<const Chunk *, const T &>;
+
+    ListIterator begin() {
+        return ListIterator(head, 0);
+    }
+
+    ListIterator end() {
+        return ListIterator(nullptr, 0);
+    }
+
+    ConstListIterator begin() const {
+        return ConstListIterator(head, 0);
+    }
+
+    ConstListIterator end() const {
+        return ConstListIterator(nullptr, 0);
+    }
+
+    ConstListIterator cbegin() const {
+        return begin();
+    }
+
+    ConstListIterator cend() const {
+        return end();
+    }
+};
@@ -1,19 +1,33 @@
+#include <charconv>
 #include <iostream>
 #include <sstream>
+#include <cstdio>
+#include <chrono>
 #include "include/render_graph.hpp"
 
 #include "tests/func/func_sequences.hpp"
 #include "tests/func/func_hash_table.hpp"
 #include "tests/func/func_set.hpp"
 #include "tests/func/func_graph.hpp"
+#include "tests/func/func_graph_io.hpp"
+#include "tests/func/func_sorts.hpp"
+#include "tests/func/func_latency.hpp"
 
 #include "tests/chrono/chrono_sequences.hpp"
 #include "tests/chrono/chrono_hash_table.hpp"
+#include "tests/chrono/chrono_hash_workload.hpp"
 #include "tests/chrono/chrono_set.hpp"
+#include "tests/chrono/chrono_sorts.hpp"
+#include "tests/chrono/chrono_allocations.hpp"
+#include "tests/chrono/chrono_graph.hpp"
+#include "tests/chrono/chrono_latency.hpp"
+#include "tests/chrono/benchmark.hpp"
+#include "tests/chrono/benchmark_report.hpp"
 
 #include "graphics/plot.hpp"
 
 #include "include/graph_generator.hpp"
+#include "include/graph_text_io.hpp"
 
 
 #ifdef _WIN32
@@ -43,6 +57,8 @@ void menuUser() {
               << "  delv <vertex>       ~ Remove a vertex\n"
               << "  adde <v1> <v2> <w>  ~ Add an edge (bidirectional) with weight w\n"
               << "  dele <v1> <v2>      ~ Remove an edge (bidirectional)\n"
+              << "  save <file>         ~ Save the graph (.l4g, .gr, .mtx, else edge list)\n"
+              << "  load <file>         ~ Load the graph (format by file extension)\n"
               << "  color               ~ Toggle vertex coloring\n"
               << "  mst                 ~ Color minimum spanning tree\n"
               << "  render              ~ Start rendering the graph\n"
@@ -66,19 +82,39 @@ void menuFunc() {
     std::cout << "Available function tests:\n"
               << "  fseq                ~ Sequence\n"
               << "  flistseq            ~ ListSequence\n"
+              << "  fdlistseq           ~ DoublyListSequence\n"
+              << "  funrlistseq         ~ UnrolledListSequence\n"
               << "  farrseq             ~ ArraySequence\n"
               << "  fhasht              ~ HashTable\n"
               << "  fhset               ~ HashSet\n"
-              << "  fgraph              ~ Graph\n";
+              << "  fgraph              ~ Graph\n"
+              << "  fgraphio            ~ Graph file formats\n"
+              << "  fsort               ~ Sorting algorithms\n"
+              << "  flatency            ~ LatencyHistogram\n";
 }
 
 void menuChrono() {
     std::cout << "Available chrono tests:\n"
               << "  chseq <value>       ~ Sequence vs std::vector\n"
-              << "  chlistseq <value>   ~ ListSequence std::list\n"
+              << "  chlistseq <value>   ~ ListSequence std::list, UnrolledListSequence\n"
+              << "  chdlistseq <value>  ~ DoublyListSequence vs std::list\n"
               << "  charrseq <value>    ~ ArraySequence vs std::vector\n"
+              << "  chcopy <value>      ~ copies of string payloads: add/emplace/insert/append, HashTable rebuild\n"
               << "  chhasht <value>     ~ HashTable vs std::unorderedmap\n"
-              << "  chhset <value>      ~ HashSet vs std::set\n";
+              << "  chhwork <value> [hit%]  ~ HashTable vs std::unordered_map: uniform/zipf/adversarial keys, read/write mixes\n"
+              << "  chhset <value>      ~ HashSet vs std::set\n"
+              << "  chsort <value>      ~ PdqSort/RadixSort vs std::sort\n"
+              << "  chpsort <value>     ~ ParallelSort by thread count\n"
+              << "  chcmp <value>       ~ Function pointer vs inlined comparators\n"
+              << "  chselect <value>    ~ nthElement/partialSort/topK vs full sort\n"
+              << "  chgalg <value> [family]  ~ Graph algorithms and mutations up to <value> vertices, scaling exponents\n"
+              << "  chlat <value>       ~ Per-operation latency percentiles: HashTable rebuilds, ArraySequence shifts\n"
+              << "  challoc <value>     ~ Allocation profile of containers and graph algorithms\n"
+              << "  challoc on|off      ~ Count allocations per call in chrono tests\n"
+              << "  chperf on|off       ~ Hardware counters (IPC, cache/branch/TLB misses per op), Linux only\n"
+              << "  chopts <runs> <ms> [cpu]  ~ Benchmark settings: runs, min sample time, CPU pinning (-1 off)\n"
+              << "  chout <file|off>    ~ Append benchmark records to file (.csv - CSV, else JSON Lines)\n"
+              << "  benchcompare <old> <new> [threshold%]  ~ Compare two result files, flag regressions\n";
 }
 
 void menuPlots() {
@@ -87,14 +123,105 @@ void menuPlots() {
               << "  plistseq <value>    ~ ListSequence vs std::list\n"
               << "  parrseq <value>     ~ ArraySequence vs std::vector\n"
               << "  phasht <value>      ~ HashTable vs std::unorderedmap\n"
-              << "  phset <value>       ~ HashSet vs std::set\n";
+              << "  phset <value>       ~ HashSet vs std::set\n"
+              << "  pgalg <family> <value>  ~ Graph algorithms vs vertices (chain, cycle, complete, random)\n"
+              << "  plat hasht|arrseq <value>  ~ Latency vs percentile (HashTable/std::unordered_map or ArraySequence/std::vector)\n";
 }
 
 void menuGen() {
     std::cout << "Available graphs:\n"
-              << "  chgraph <value> <min_w> <max_w>    ~ Chain & number of vertexes\n"
-              << "  cygraph <value> <min_w> <max_w>    ~ Cycle & number of vertexes\n"
-              << "  cograph <value> <min_w> <max_w>    ~ Complete & number of vertexes\n";
+              << "  chgraph <value> <min_w> <max_w>          ~ Chain & number of vertexes\n"
+              << "  cygraph <value> <min_w> <max_w>          ~ Cycle & number of vertexes\n"
+              << "  cograph <value> <min_w> <max_w>          ~ Complete & number of vertexes\n"
+              << "  ergraph <value> <p> <min_w> <max_w>      ~ Erdos-Renyi G(n, p)\n"
+              << "  rmgraph <value> <edges> <min_w> <max_w>  ~ R-MAT (Kronecker) with given number of edges\n"
+              << "  bagraph <value> <m> <min_w> <max_w>      ~ Barabasi-Albert, m edges per new vertex\n"
+              << "  grgraph <rows> <cols> <min_w> <max_w>    ~ 2D grid rows x cols\n"
+              << "Optional trailing [seed] [mt|xoshiro] make the graph reproducible.\n";
+}
+
+void genProcess(Graph<std::string> &graph) {
+    menuGen();
+    std::cout << "> ";
+    std::string command;
+    std::getline(std::cin, command);
+    std::stringstream ss(command);
+    std::string choise;
+    int numbers;
+    int min_w;
+    int max_w;
+    double probability = 0;
+    int extra = 0;
+    ss >> choise;
+
+    if (!readValue(ss, numbers, "Error: Number of vertices is required.")) { return; }
+    if (choise == "ergraph") {
+        if (!readValue(ss, probability, "Error: Edge probability is required.")) { return; }
+    } else if (choise == "rmgraph" || choise == "bagraph" || choise == "grgraph") {
+        if (!readValue(ss, extra, "Error: Graph parameter is required.")) { return; }
+        // Число рёбер R-MAT дальше приводится к size_t: отрицательное превратилось бы в огромное
+        if (choise == "rmgraph" && extra <= 0) {
+            std::cerr << "Error: Number of edges must be positive.\n";
+            return;
+        }
+    }
+    if (!readValue(ss, min_w, "Error: Minimum weight is required.")) { return; }
+    if (!readValue(ss, max_w, "Error: Maximum weight is required.")) { return; }
+
+    // Необязательные зерно и движок: без зерна берётся случайное, и оно печатается для повтора.
+    // Первый токен - зерно, если это число, иначе - имя движка
+    uint64_t seed = std::random_device{}();
+    std::string engine = "xoshiro";
+    std::string token;
+    if (ss >> token) {
+        uint64_t value = 0;
+        auto result = std::from_chars(token.data(), token.data() + token.size(), value);
+        if (result.ec == std::errc() && result.ptr == token.data() + token.size()) {
+            seed = value;
+            ss >> engine;
+        } else if (result.ec == std::errc::result_out_of_range) {
+            std::cerr << "Error: Seed is too large: " << token << "\n";
+            return;
+        } else {
+            engine = token;
+        }
+    }
+    if (ss >> token) {
+        std::cerr << "Error: Unexpected argument '" << token << "'.\n";
+        return;
+    }
+
+    try {
+        GeneratorContext ctx(seed, parseRngEngine(engine));
+        if (choise == "chgraph") {
+            graph = generateChainGraph<std::string>(numbers, min_w, max_w, ctx);
+            std::cout << "Chain graph generated.\n";
+        } else if (choise == "cygraph") {
+            graph = generateCycleGraph<std::string>(numbers, min_w, max_w, ctx);
+            std::cout << "Cycle graph generated.\n";
+        } else if (choise == "cograph") {
+            graph = generateCompleteGraph<std::string>(numbers, min_w, max_w, ctx);
+            std::cout << "Complete graph generated.\n";
+        } else if (choise == "ergraph") {
+            graph = generateRandomGraph<std::string>(numbers, probability, min_w, max_w, ctx);
+            std::cout << "Erdos-Renyi graph generated.\n";
+        } else if (choise == "rmgraph") {
+            graph = generateRMatGraph<std::string>(numbers, extra, min_w, max_w, ctx);
+            std::cout << "R-MAT graph generated.\n";
+        } else if (choise == "bagraph") {
+            graph = generateBarabasiAlbertGraph<std::string>(numbers, extra, min_w, max_w, ctx);
+            std::cout << "Barabasi-Albert graph generated.\n";
+        } else if (choise == "grgraph") {
+            graph = generateGridGraph<std::string>(numbers, extra, min_w, max_w, ctx);
+            std::cout << "Grid graph generated.\n";
+        } else {
+            std::cout << "Unknown command.\n";
+            return;
+        }
+        std::cout << "Seed: " << ctx.seed << " (" << rngEngineName(ctx.engine) << ")\n";
+    } catch (const std::exception& e) {
+        std::cerr << "\tError: " << e.what();
+    }
 }
 
 void adminProcess() {
@@ -112,6 +239,10 @@ void adminProcess() {
             testSequence();
         } else if (command == "flistseq") {
             testListSequence();
+        } else if (command == "fdlistseq") {
+            testDoublyListSequence();
+        } else if (command == "funrlistseq") {
+            testUnrolledListSequence();
         } else if (command == "farrseq") {
             testArraySequence();
         } else if (command == "fhasht") {
@@ -120,21 +251,136 @@ void adminProcess() {
             testSet();
         } else if (command == "fgraph") {
             testGraph();
+        } else if (command == "fgraphio") {
+            testGraphIO();
+        } else if (command == "fsort") {
+            testSorts();
+        } else if (command == "flatency") {
+            testLatencyHistogram();
         } else if (command == "chseq") {
             if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
             chronoSequence(values, 100);
+        } else if (command == "chcopy") {
+            if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
+            chronoCopies(values);
         } else if (command == "chlistseq") {
             if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
             chronoListSequence(values, 100);
+        } else if (command == "chdlistseq") {
+            if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
+            chronoDoublyListSequence(values, 100);
         } else if (command == "charrseq") {
             if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
             chronoArraySequence(values, 100);
         } else if (command == "chhasht") {
             if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
             chronoHashTable(values);
+        } else if (command == "chhwork") {
+            if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
+            double hits = 90;
+            double requested = 0;
+            if (ss >> requested) {
+                hits = requested;
+            }
+            if (hits < 0 || hits > 100) {
+                std::cout << "Error: Hit ratio must be between 0 and 100." << std::endl;
+                return;
+            }
+            chronoHashWorkload(values, hits / 100);
         } else if (command == "chhset") {
             if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
             chronoSet(values);
+        } else if (command == "chsort") {
+            if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
+            chronoSorts(values);
+        } else if (command == "chpsort") {
+            if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
+            chronoParallelSort(values);
+        } else if (command == "chcmp") {
+            if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
+            chronoComparators(values);
+        } else if (command == "chselect") {
+            if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
+            chronoSelection(values);
+        } else if (command == "chgalg") {
+            if (!readValue(ss, values, "Error: Number of vertices is required.")) { return; }
+            std::string family;
+            try {
+                if (ss >> family) {
+                    chronoGraphScaling(family, values);
+                } else {
+                    chronoGraph(values);
+                }
+            } catch (const std::invalid_argument &error) {
+                std::cerr << "Error: " << error.what() << std::endl;
+            }
+        } else if (command == "chlat") {
+            if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
+            chronoLatency(values);
+        } else if (command == "challoc") {
+            std::string mode;
+            if (!readValue(ss, mode, "Error: Number of values or 'on'/'off' is required.")) { return; }
+            if (mode == "on" || mode == "off") {
+                benchmarkOptions().count_allocations = mode == "on";
+                std::cout << "Allocation counting " << (mode == "on" ? "enabled." : "disabled.") << std::endl;
+            } else {
+                std::stringstream value_ss(mode);
+                if (!readValue(value_ss, values, "Error: Number of values or 'on'/'off' is required.")) { return; }
+                chronoAllocations(values);
+            }
+        } else if (command == "chperf") {
+            std::string mode;
+            if (!readValue(ss, mode, "Error: 'on' or 'off' is required.")) { return; }
+            if (mode != "on" && mode != "off") {
+                std::cout << "Error: 'on' or 'off' is required." << std::endl;
+                return;
+            }
+            benchmarkOptions().perf_counters = mode == "on";
+            if (mode == "on") {
+                PerfCounters probe;
+                std::cout << (probe.available() ? "Hardware counters enabled." : "Hardware counters unavailable.");
+                if (!probe.unavailableReason().empty()) {
+                    std::cout << " " << probe.unavailableReason();
+                }
+                std::cout << std::endl;
+            } else {
+                std::cout << "Hardware counters disabled." << std::endl;
+            }
+        } else if (command == "chopts") {
+            BenchmarkOptions &options = benchmarkOptions();
+            int runs;
+            double sample_ms;
+            if (!readValue(ss, runs, "Error: Number of runs is required.")) { return; }
+            if (!readValue(ss, sample_ms, "Error: Minimum sample time is required.")) { return; }
+            if (runs < 1 || sample_ms <= 0) {
+                std::cout << "Error: Runs and sample time must be positive." << std::endl;
+                return;
+            }
+            options.repetitions = runs;
+            options.min_sample_ms = sample_ms;
+            int cpu;
+            if (ss >> cpu) {
+                options.cpu = cpu;
+            }
+            std::cout << "Benchmarks: " << options.repetitions << " runs, min sample " << options.min_sample_ms
+                      << " ms, CPU " << (options.cpu >= 0 ? std::to_string(options.cpu) : "not pinned") << std::endl;
+        } else if (command == "chout") {
+            std::string path;
+            if (!readValue(ss, path, "Error: File name or 'off' is required.")) { return; }
+            benchmarkOptions().output_path = path == "off" ? "" : path;
+            std::cout << (path == "off" ? "Benchmark records disabled." : "Benchmark records: " + path) << std::endl;
+        } else if (command == "benchcompare") {
+            std::string baseline;
+            std::string current;
+            if (!readValue(ss, baseline, "Error: Baseline file is required.")) { return; }
+            if (!readValue(ss, current, "Error: Current file is required.")) { return; }
+            double threshold = 5;
+            ss >> threshold;
+            try {
+                compareBenchmarks(baseline, current, threshold / 100);
+            } catch (const std::runtime_error &error) {
+                std::cerr << "Error: " << error.what() << std::endl;
+            }
         } else if (command == "pseq") {
             if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
 
@@ -170,6 +416,70 @@ void adminProcess() {
             plot_data.add(DataSeries("std::set", Color::Blue));
 
             plotInit<HashSet<int>, std::set<int>>(values, plot_data);
+        } else if (command == "pgalg") {
+            std::string family;
+            if (!readValue(ss, family, "Error: Graph family is required.")) { return; }
+            if (!readValue(ss, values, "Error: Number of vertices is required.")) { return; }
+
+            if (!isChronoGraphFamily(family)) {
+                std::cout << "Error: Unknown graph family '" << family << "' (chain, cycle, complete, random)"
+                          << std::endl;
+                return;
+            }
+
+            // Замеры идут в фоновом потоке, точки (медиана и разброс по выборкам) появляются по мере готовности
+            const Color colors[] = {Color::Red, Color::Blue, Color::Green, Color::Magenta, Color::Cyan,
+                                    Color(255, 140, 0)};
+            for (const Color &color: colors) {
+                plot_data.add(DataSeries("", color));
+            }
+            PlotOptions options;
+            options.x_title = "Vertices, counts";
+            options.log_x = true;
+            options.log_y = true;
+            size_t expected = plot_data.getSize() * chronoGraphSizeCount(family, values);
+            // Таблица замеров копится в буфере и печатается после закрытия окна: консоль - только у этого потока
+            std::ostringstream log;
+            plotLive(plot_data, options, expected, [family, values, &log](PlotFeed &feed) {
+                auto stream = [&feed](const std::vector<GraphScalingSeries> &scaling) {
+                    if (!scaling.empty()) {
+                        feed.setStatus(std::to_string(scaling[0].vertices.back()) + " vertices measured");
+                    }
+                    for (size_t i = 0; i < scaling.size(); ++i) {
+                        size_t j = scaling[i].vertices.size() - 1;
+                        feed.setTitle(i, scaling[i].operation);
+                        feed.add(i, {static_cast<int>(scaling[i].vertices[j]), scaling[i].ms_per_op[j],
+                                     scaling[i].ms_stddev[j]});
+                    }
+                    return !feed.cancelled();
+                };
+                feed.setStatus("Measuring " + family + " graphs...");
+                std::vector<GraphScalingSeries> scaling = chronoGraphScaling(family, values, stream, log);
+                for (size_t i = 0; i < scaling.size(); ++i) {
+                    char title[64];
+                    std::snprintf(title, sizeof(title), "%s ~V^%.2f", scaling[i].operation.c_str(),
+                                  scaling[i].vertex_exponent);
+                    feed.setTitle(i, title);
+                }
+            });
+            std::cout << log.str();
+        } else if (command == "plat") {
+            std::string group;
+            if (!readValue(ss, group, "Error: 'hasht' or 'arrseq' is required.")) { return; }
+            if (group != "hasht" && group != "arrseq") {
+                std::cout << "Error: 'hasht' or 'arrseq' is required." << std::endl;
+                return;
+            }
+            if (!readValue(ss, values, "Error: Number of values is required.")) { return; }
+
+            const Color colors[] = {Color::Red, Color::Blue, Color::Green, Color::Magenta};
+            size_t index = 0;
+            for (const LatencyProfile &profile: chronoLatency(values)) {
+                if (profile.group == group) {
+                    plot_data.add(DataSeries(percentileDots(profile.histogram), profile.operation, colors[index++ % 4]));
+                }
+            }
+            plotSeries(plot_data, "Percentile", "Latency, ns", percentileTick);
         } else if (command == "func") {
             menuFunc();
         } else if (command == "chrono") {
@@ -189,7 +499,12 @@ void adminProcess() {
     }
 }
 
-int main() {
+int main(int argc, char *argv[]) {
+    // Без интерактивного режима: lab4 benchcompare <baseline> <current> [threshold%]
+    if (argc > 1 && std::string(argv[1]) == "benchcompare") {
+        return benchCompareMain(argc - 1, argv + 1);
+    }
+
     Graph<std::string> graph;
 
     menuUser();
@@ -206,33 +521,8 @@ int main() {
         if (command == "help") {
             menuUser();
         } else if (command == "gen") {
-            Graph<std::string> gen_graph;
-            std::string choise;
-            int numbers;
-            int min_w;
-            int max_w;
-            menuGen();
-            std::cout << "> ";
-            std::cin >> choise;
-            std::cin >> numbers;
-            std::cin >> min_w;
-            std::cin >> max_w;
-            try {
-                if (choise == "chgraph") {
-                    graph = generateChainGraph<std::string>(numbers, min_w, max_w);
-                    std::cout << "Chain graph generated.\n";
-                } else if (choise == "cygraph") {
-                    graph = generateCycleGraph<std::string>(numbers, min_w, max_w);
-                    std::cout << "Cycle graph generated.\n";
-                } else if (choise == "cograph") {
-                    graph = generateCompleteGraph<std::string>(numbers, min_w, max_w);
-                    std::cout << "Complete graph generated.\n";
-                } else {
-                    std::cout << "Unknown command.\n";
-                }
-            } catch (const std::exception& e) {
-                std::cerr << "\tError: " << e.what();
-            }
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            genProcess(graph);
         } else if (command == "addv") {
             std::string v;
             std::cin >> v;
@@ -274,6 +564,30 @@ int main() {
                 std::cerr << "\tError: " << e.what();
             }
         }
+        else if (command == "save") {
+            std::string path;
+            std::cin >> path;
+            try {
+                saveGraph(graph, path);
+                std::cout << "Graph saved to " << path << ".\n";
+            } catch (const std::exception& e) {
+                std::cerr << "\tError: " << e.what();
+            }
+        }
+        else if (command == "load") {
+            std::string path;
+            std::cin >> path;
+            try {
+                ImportStats stats;
+                graph = loadGraph<std::string>(path, &stats);
+                std::cout << "Graph loaded: " << stats.vertices << " vertexes, " << stats.edges << " edges ("
+                          << stats.bytes / (1024.0 * 1024.0) << " MB read in " << stats.parse_seconds * 1000
+                          << " ms, " << stats.throughput() << " MB/s; total " << stats.total_seconds * 1000
+                          << " ms).\n";
+            } catch (const std::exception& e) {
+                std::cerr << "\tError: " << e.what();
+            }
+        }
         else if (command == "color") {
             needColor = !needColor;
             std::cout << "Vertex coloring is now " << (needColor ? "enabled" : "disabled") << ".\n";
@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include "allocation_counter.hpp"
+
+#if defined(_WIN32) || defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+
+namespace {
+    // Счётчики свои у каждого потока: область видит только выделения открывшего её потока
+    // (например, замер в фоновом потоке живого графика не считает выделения окна)
+    thread_local int active_scopes = 0;
+    thread_local size_t allocation_count = 0;
+    thread_local size_t allocated_bytes = 0;
+    thread_local long long live_bytes = 0;
+    thread_local long long peak_live_bytes = 0;
+
+    size_t blockSize(void *pointer) {
+#if defined(_WIN32)
+        return _msize(pointer);
+#elif defined(__GLIBC__)
+        return malloc_usable_size(pointer);
+#else
+        (void) pointer;
+        return 0;
+#endif
+    }
+
+    void *countedAllocate(size_t size) noexcept {
+        void *pointer = std::malloc(size ? size : 1);
+        if (pointer && active_scopes > 0) {
+            ++allocation_count;
+            allocated_bytes += size;
+            live_bytes += static_cast<long long>(blockSize(pointer));
+            peak_live_bytes = std::max(peak_live_bytes, live_bytes);
+        }
+        return pointer;
+    }
+
+    void countedFree(void *pointer) noexcept {
+        if (pointer && active_scopes > 0) {
+            live_bytes -= static_cast<long long>(blockSize(pointer));
+        }
+        std::free(pointer);
+    }
+
+    void *allocateOrThrow(size_t size) {
+        void *pointer = countedAllocate(size);
+        if (!pointer) {
+            throw std::bad_alloc();
+        }
+        return pointer;
+    }
+}
+
+// Варианты с выравниванием (align_val_t) не заменяются: стандартная библиотека обслуживает их
+// отдельно, и такие выделения не попадают в статистику
+void *operator new(size_t size) {
+    return allocateOrThrow(size);
+}
+
+void *operator new[](size_t size) {
+    return allocateOrThrow(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+    return countedAllocate(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+    return countedAllocate(size);
+}
+
+void operator delete(void *pointer) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void *pointer, size_t) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept {
+    countedFree(pointer);
+}
+
+
+bool allocationPeakSupported() {
+#if defined(_WIN32) || defined(__GLIBC__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+AllocationScope::AllocationScope() {
+    outer_active = active_scopes > 0;
+    start_count = allocation_count;
+    start_bytes = allocated_bytes;
+    start_live = live_bytes;
+    outer_peak = peak_live_bytes;
+    peak_live_bytes = start_live;
+    ++active_scopes;
+}
+
+AllocationScope::~AllocationScope() {
+    --active_scopes;
+    // Внешняя область продолжает видеть свой пик
+    if (outer_active) {
+        peak_live_bytes = std::max(outer_peak, peak_live_bytes);
+    }
+}
+
+AllocationStats AllocationScope::stats() const {
+    AllocationStats stats;
+    stats.count = allocation_count - start_count;
+    stats.bytes = allocated_bytes - start_bytes;
+    stats.peak_bytes = static_cast<size_t>(std::max(peak_live_bytes - start_live, 0LL));
+    stats.live_bytes = static_cast<size_t>(std::max(live_bytes - start_live, 0LL));
+    return stats;
+}
+
+std::string formatBytes(double bytes) {
+    static const char *units[] = {"B", "KB", "MB", "GB"};
+    size_t unit = 0;
+    while (unit < 3 && bytes >= 1024) {
+        bytes /= 1024;
+        ++unit;
+    }
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), unit == 0 ? "%.0f %s" : bytes < 10 ? "%.2f %s" : "%.1f %s", bytes,
+                  units[unit]);
+    return buffer;
+}
+
+std::string formatAllocationStats(const AllocationStats &stats) {
+    std::string text = std::to_string(stats.count) + (stats.count == 1 ? " alloc, " : " allocs, ") +
+                       formatBytes(static_cast<double>(stats.bytes));
+    if (allocationPeakSupported()) {
+        text += ", peak " + formatBytes(static_cast<double>(stats.peak_bytes));
+    }
+    return text;
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+
+// Подсчёт выделений памяти. Глобальные operator new/delete заменены в allocation_counter.cpp
+// и считают вызовы, только пока открыт хотя бы один AllocationScope (в остальное время - malloc/free
+// и проверка флага). Учитываются только выделения потока, открывшего область: остальные потоки
+// на статистику не влияют, память, освобождённая другим потоком, остаётся в live_bytes.
+// Вложенные области допускаются, у каждого потока свои.
+struct AllocationStats {
+    size_t count = 0;               // вызовов operator new
+    size_t bytes = 0;               // запрошено байт
+    size_t peak_bytes = 0;          // пик живых байт сверх уровня на начало области
+    size_t live_bytes = 0;          // не освобождено к моменту снятия статистики
+};
+
+// Пик и живые байты считаются по фактическому размеру блоков malloc; если платформа его не сообщает,
+// эти поля остаются нулевыми
+bool allocationPeakSupported();
+
+class AllocationScope {
+private:
+    size_t start_count;
+    size_t start_bytes;
+    long long start_live;
+    long long outer_peak;
+    bool outer_active;
+
+public:
+    AllocationScope();
+
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope &) = delete;
+
+    AllocationScope &operator=(const AllocationScope &) = delete;
+
+    [[nodiscard]] AllocationStats stats() const;
+};
+
+// "12 allocs, 1.50 MB, peak 768 KB"
+std::string formatAllocationStats(const AllocationStats &stats);
+
+std::string formatBytes(double bytes);
+
+
+// Аллокатор для std-контейнеров: ведёт статистику конкретного контейнера независимо от глобального
+// перехвата (копии аллокатора, в том числе rebind-копии узлов, пишут в один и тот же AllocationStats)
+template<typename T>
+class CountingAllocator {
+private:
+    template<typename U>
+    friend class CountingAllocator;
+
+    AllocationStats *stats;
+
+public:
+    using value_type = T;
+
+    explicit CountingAllocator(AllocationStats &stats) noexcept: stats(&stats) {}
+
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U> &other) noexcept: stats(other.stats) {}
+
+    T *allocate(size_t n) {
+        T *pointer = std::allocator<T>().allocate(n);
+        ++stats->count;
+        stats->bytes += n * sizeof(T);
+        stats->live_bytes += n * sizeof(T);
+        if (stats->live_bytes > stats->peak_bytes) {
+            stats->peak_bytes = stats->live_bytes;
+        }
+        return pointer;
+    }
+
+    void deallocate(T *pointer, size_t n) noexcept {
+        stats->live_bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(pointer, n);
+    }
+
+    template<typename U>
+    bool operator==(const CountingAllocator<U> &other) const noexcept {
+        return stats == other.stats;
+    }
+
+    template<typename U>
+    bool operator!=(const CountingAllocator<U> &other) const noexcept {
+        return stats != other.stats;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,201 @@
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "chrono_sequences.hpp"
+#include "chrono_hash_table.hpp"
+#include "chrono_hash_workload.hpp"
+#include "chrono_set.hpp"
+#include "chrono_sorts.hpp"
+#include "chrono_allocations.hpp"
+#include "chrono_graph.hpp"
+#include "chrono_latency.hpp"
+#include "benchmark.hpp"
+#include "benchmark_report.hpp"
+
+
+// Консольный запуск нагрузочных тестов без SFML и интерактивного меню (цель lab4_bench)
+
+namespace {
+    struct BenchSuiteEntry {
+        const char *name;           // совпадает с командой админки без префикса "ch"
+        const char *description;
+        void (*run)(size_t num_elements);
+    };
+
+    const BenchSuiteEntry bench_suites[] = {
+            {"seq",      "Sequence vs std::vector",                        [](size_t n) { chronoSequence(n, 100); }},
+            {"listseq",  "ListSequence vs std::list, UnrolledListSequence", [](size_t n) { chronoListSequence(n, 100); }},
+            {"dlistseq", "DoublyListSequence vs std::list",                [](size_t n) { chronoDoublyListSequence(n, 100); }},
+            {"arrseq",   "ArraySequence vs std::vector",                   [](size_t n) { chronoArraySequence(n, 100); }},
+            {"copy",     "Element copies in add/emplace/insert/append",    chronoCopies},
+            {"hasht",    "HashTable vs std::unordered_map",                chronoHashTable},
+            {"hwork",    "Key distributions and read/write mixes, latency percentiles", [](size_t n) { chronoHashWorkload(n); }},
+            {"hset",     "HashSet vs std::set",                            chronoSet},
+            {"sort",     "PdqSort, RadixSort, std::sort, QuickSort",       chronoSorts},
+            {"psort",    "ParallelSort by thread count",                   chronoParallelSort},
+            {"cmp",      "Function pointer vs inlined comparators",        chronoComparators},
+            {"select",   "nthElement/partialSort/topK vs full sort",       chronoSelection},
+            {"galg",     "Graph algorithms and mutations, scaling exponents", chronoGraph},
+            {"lat",      "Per-operation latency percentiles of inserts/removals", [](size_t n) { chronoLatency(n); }},
+            {"alloc",    "Allocations of containers and graph algorithms", chronoAllocations},
+    };
+
+    void printUsage() {
+        std::cout << "Usage: lab4_bench [options] [suite...]\n"
+                  << "       lab4_bench compare <baseline> <current> [threshold%]\n\n"
+                  << "Suites are selected by name; a name that is not an exact suite name selects every suite\n"
+                  << "containing it as a substring. Without names all suites run.\n\n"
+                  << "Options:\n"
+                  << "  --sizes <n1,n2,...>  Element counts, each suite runs for every size (default 10000)\n"
+                  << "  --runs <count>       Samples per scenario\n"
+                  << "  --min-ms <ms>        Minimal duration of one sample\n"
+                  << "  --budget-ms <ms>     Approximate time limit per scenario\n"
+                  << "  --cpu <index>        Pin the benchmark thread to a CPU\n"
+                  << "  --out <file>         Append records to file (.csv - CSV, else JSON Lines)\n"
+                  << "  --allocs             Count allocations per call (one extra untimed call)\n"
+                  << "  --perf               Read hardware counters via perf_event_open (one extra untimed sample)\n"
+                  << "  --list               List suites and exit\n"
+                  << "  --help               Show this help\n";
+    }
+
+    void printSuites() {
+        for (const BenchSuiteEntry &suite: bench_suites) {
+            std::cout << "  " << suite.name << std::string(10 - std::string(suite.name).size(), ' ')
+                      << suite.description << "\n";
+        }
+    }
+
+    std::vector<size_t> parseSizes(const std::string &text) {
+        std::vector<size_t> sizes;
+        std::stringstream ss(text);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            char *end = nullptr;
+            unsigned long long value = std::strtoull(item.c_str(), &end, 10);
+            if (item.empty() || *end != '\0' || value == 0) {
+                throw std::invalid_argument("Invalid size: '" + item + "'");
+            }
+            sizes.push_back(static_cast<size_t>(value));
+        }
+        if (sizes.empty()) {
+            throw std::invalid_argument("No sizes given");
+        }
+        return sizes;
+    }
+
+    double parsePositive(const std::string &option, const std::string &text) {
+        char *end = nullptr;
+        double value = std::strtod(text.c_str(), &end);
+        if (text.empty() || *end != '\0' || value <= 0) {
+            throw std::invalid_argument("Invalid value for " + option + ": '" + text + "'");
+        }
+        return value;
+    }
+
+    bool isSuiteName(const std::string &filter) {
+        for (const BenchSuiteEntry &suite: bench_suites) {
+            if (filter == suite.name) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Точное имя выбирает только свой сценарий ("seq" - не listseq и arrseq, "sort" - не psort),
+    // остальные фильтры ищутся как подстрока
+    bool selected(const BenchSuiteEntry &suite, const std::vector<std::string> &filters) {
+        if (filters.empty()) {
+            return true;
+        }
+        for (const std::string &filter: filters) {
+            if (isSuiteName(filter) ? filter == suite.name
+                                    : std::string(suite.name).find(filter) != std::string::npos) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "compare") {
+        return benchCompareMain(argc - 1, argv + 1);
+    }
+
+    BenchmarkOptions &options = benchmarkOptions();
+    std::vector<size_t> sizes = {10000};
+    std::vector<std::string> filters;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h") {
+                printUsage();
+                return 0;
+            }
+            if (arg == "--list") {
+                printSuites();
+                return 0;
+            }
+            if (arg.rfind("--", 0) != 0) {
+                filters.push_back(arg);
+                continue;
+            }
+            if (arg == "--allocs") {
+                options.count_allocations = true;
+                continue;
+            }
+            if (arg == "--perf") {
+                options.perf_counters = true;
+                continue;
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + arg);
+            }
+            std::string value = argv[++i];
+            if (arg == "--sizes") {
+                sizes = parseSizes(value);
+            } else if (arg == "--runs") {
+                options.repetitions = static_cast<size_t>(parsePositive(arg, value));
+            } else if (arg == "--min-ms") {
+                options.min_sample_ms = parsePositive(arg, value);
+            } else if (arg == "--budget-ms") {
+                options.budget_ms = parsePositive(arg, value);
+            } else if (arg == "--cpu") {
+                options.cpu = std::atoi(value.c_str());
+            } else if (arg == "--out") {
+                options.output_path = value;
+            } else {
+                throw std::invalid_argument("Unknown option " + arg);
+            }
+        }
+    } catch (const std::invalid_argument &error) {
+        std::cerr << "Error: " << error.what() << "\n\n";
+        printUsage();
+        return 2;
+    }
+
+    size_t matched = 0;
+    for (const BenchSuiteEntry &suite: bench_suites) {
+        if (!selected(suite, filters)) {
+            continue;
+        }
+        ++matched;
+        for (size_t size: sizes) {
+            try {
+                suite.run(size);
+            } catch (const std::exception &error) {
+                std::cerr << "Error in " << suite.name << " (" << size << "): " << error.what() << std::endl;
+                return 1;
+            }
+        }
+    }
+    if (matched == 0) {
+        std::cerr << "Error: No suite matches the filter. Available suites:" << std::endl;
+        printSuites();
+        return 2;
+    }
+    return 0;
+}
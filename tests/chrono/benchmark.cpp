@@ -0,0 +1,249 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <numeric>
+#include "benchmark.hpp"
+#include "benchmark_report.hpp"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#define PSAPI_VERSION 2
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <fstream>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+
+#if !defined(__GNUC__) && !defined(__clang__)
+void benchmarkEscape(const void *pointer) {
+    static const void *volatile sink;
+    sink = pointer;
+}
+#endif
+
+BenchmarkOptions &benchmarkOptions() {
+    static BenchmarkOptions options;
+    return options;
+}
+
+BenchmarkResult summarizeSamples(const BenchmarkCase &info, size_t items, size_t iterations,
+                                 std::vector<double> samples) {
+    BenchmarkResult result;
+    result.info = info;
+    result.items = std::max<size_t>(items, 1);
+    result.iterations = iterations;
+    result.repetitions = samples.size();
+    if (samples.empty()) {
+        return result;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    size_t n = samples.size();
+    result.median_ns = n % 2 ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+    // p95 - по ближайшему рангу
+    size_t rank = static_cast<size_t>(std::ceil(0.95 * static_cast<double>(n)));
+    result.p95_ns = samples[std::max<size_t>(rank, 1) - 1];
+    result.min_ns = samples.front();
+    result.mean_ns = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(n);
+    if (n > 1) {
+        double squares = 0;
+        for (double value: samples) {
+            squares += (value - result.mean_ns) * (value - result.mean_ns);
+        }
+        result.stddev_ns = std::sqrt(squares / static_cast<double>(n - 1));
+    }
+    return result;
+}
+
+std::string formatDuration(double ns) {
+    static const char *units[] = {"ns", "us", "ms", "s"};
+    size_t unit = 0;
+    while (unit < 3 && std::fabs(ns) >= 1000) {
+        ns /= 1000;
+        ++unit;
+    }
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), ns < 10 ? "%.3f %s" : ns < 100 ? "%.2f %s" : "%.1f %s", ns, units[unit]);
+    return buffer;
+}
+
+double fitScalingExponent(const std::vector<double> &sizes, const std::vector<double> &times) {
+    std::vector<std::pair<double, double>> points;
+    for (size_t i = 0; i < std::min(sizes.size(), times.size()); ++i) {
+        if (sizes[i] > 0 && times[i] > 0) {
+            points.emplace_back(std::log(sizes[i]), std::log(times[i]));
+        }
+    }
+    if (points.size() < 2) {
+        return std::nan("");
+    }
+    double mean_x = 0;
+    double mean_y = 0;
+    for (const auto &[x, y]: points) {
+        mean_x += x;
+        mean_y += y;
+    }
+    mean_x /= static_cast<double>(points.size());
+    mean_y /= static_cast<double>(points.size());
+    double covariance = 0;
+    double variance = 0;
+    for (const auto &[x, y]: points) {
+        covariance += (x - mean_x) * (y - mean_y);
+        variance += (x - mean_x) * (x - mean_x);
+    }
+    return variance > 0 ? covariance / variance : std::nan("");
+}
+
+size_t currentRssBytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.WorkingSetSize;
+    }
+    return 0;
+#elif defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    if (statm >> total_pages >> resident_pages) {
+        return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+double clockOverheadNs() {
+    using Clock = std::chrono::steady_clock;
+    static const double overhead = [] {
+        std::vector<double> samples(1001);
+        for (double &sample: samples) {
+            auto start = Clock::now();
+            auto end = Clock::now();
+            sample = std::chrono::duration<double, std::nano>(end - start).count();
+        }
+        std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+        return samples[samples.size() / 2];
+    }();
+    return overhead;
+}
+
+std::string formatLatencyPercentiles(const LatencyHistogram &histogram) {
+    static const std::pair<const char *, double> percentiles[] = {
+            {"p50", 50}, {"p90", 90}, {"p99", 99}, {"p99.9", 99.9}};
+    std::string text;
+    for (const auto &[name, percent]: percentiles) {
+        text += std::string(name) + " " + formatDuration(static_cast<double>(histogram.percentile(percent))) + ", ";
+    }
+    return text + "max " + formatDuration(static_cast<double>(histogram.max()));
+}
+
+namespace {
+#if defined(_WIN32)
+    DWORD_PTR saved_affinity = 0;
+#elif defined(__linux__)
+    cpu_set_t saved_affinity;
+#endif
+
+    bool pinCurrentThread(int cpu) {
+#if defined(_WIN32)
+        saved_affinity = SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu);
+        return saved_affinity != 0;
+#elif defined(__linux__)
+        if (sched_getaffinity(0, sizeof(saved_affinity), &saved_affinity) != 0) {
+            return false;
+        }
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+        return false;
+#endif
+    }
+
+    void unpinCurrentThread() {
+#if defined(_WIN32)
+        SetThreadAffinityMask(GetCurrentThread(), saved_affinity);
+#elif defined(__linux__)
+        sched_setaffinity(0, sizeof(saved_affinity), &saved_affinity);
+#endif
+    }
+}
+
+BenchmarkSuite::BenchmarkSuite(const std::string &title, std::ostream &out)
+        : title(title), out(out), pinned(false), capture_rss(false), observed_rss(0), probe_allocations(false),
+          probe_perf(false) {
+    const BenchmarkOptions &options = benchmarkOptions();
+    out << title << std::endl;
+    out << "(" << options.repetitions << " runs, min sample " << options.min_sample_ms << " ms, warmup "
+              << options.warmup_runs;
+    if (options.count_allocations) {
+        out << ", counting allocations";
+    }
+    if (options.perf_counters) {
+        perf = std::make_unique<PerfCounters>();
+        out << (perf->available() ? ", perf counters" : ", perf counters unavailable");
+    }
+    if (options.cpu >= 0) {
+        pinned = pinCurrentThread(options.cpu);
+        out << (pinned ? ", pinned to CPU " : ", failed to pin to CPU ") << options.cpu;
+    }
+    out << ")" << std::endl;
+    if (perf && !perf->unavailableReason().empty()) {
+        out << "Note: " << perf->unavailableReason() << std::endl;
+    }
+    out << std::endl;
+}
+
+BenchmarkSuite::~BenchmarkSuite() {
+    if (pinned) {
+        unpinCurrentThread();
+    }
+    out << std::endl;
+}
+
+void BenchmarkSuite::section(const std::string &heading) {
+    if (!collected.empty()) {
+        out << std::endl;
+    }
+    out << heading << ":" << std::endl;
+}
+
+void BenchmarkSuite::report(const BenchmarkResult &result) {
+    double spread = result.mean_ns > 0 ? result.stddev_ns / result.mean_ns * 100 : 0;
+    char deviation[16];
+    std::snprintf(deviation, sizeof(deviation), "%.1f%%", spread);
+    out << "  " << result.info.displayName() << ": median " << formatDuration(result.median_ns)
+              << ", p95 " << formatDuration(result.p95_ns)
+              << ", sd " << deviation;
+    if (result.items > 1) {
+        out << ", " << formatDuration(result.nsPerItem()) << "/op";
+    }
+    out << " [" << result.iterations << " x " << result.repetitions << "]";
+    if (result.truncated) {
+        out << " truncated: one call exceeds the budget of " << benchmarkOptions().budget_ms << " ms";
+    }
+    out << std::endl;
+    if (result.allocations >= 0) {
+        AllocationStats stats;
+        stats.count = static_cast<size_t>(result.allocations);
+        stats.bytes = static_cast<size_t>(result.allocated_bytes);
+        stats.peak_bytes = static_cast<size_t>(result.peak_bytes);
+        out << "      memory per call: " << formatAllocationStats(stats) << std::endl;
+    }
+    if (!result.perf.empty()) {
+        out << "      counters: " << formatPerfReading(result.perf.scaled(static_cast<double>(result.items)))
+                  << std::endl;
+    }
+
+    const std::string &output_path = benchmarkOptions().output_path;
+    if (!output_path.empty() && !writeBenchmarkRecord(output_path, result)) {
+        std::cerr << "Error: Cannot write benchmark record to " << output_path << std::endl;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,334 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "allocation_counter.hpp"
+#include "../../include/latency_histogram.hpp"
+#include "perf_counters.hpp"
+
+
+// Барьеры для оптимизатора: значение считается использованным, память - прочитанной и изменённой.
+// Заменяют volatile-переменные, которые мешают компилятору сильнее, чем реальный код.
+#if defined(__GNUC__) || defined(__clang__)
+
+template<typename T>
+inline void doNotOptimize(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template<typename T>
+inline void doNotOptimize(T &value) {
+    asm volatile("" : "+r,m"(value) : : "memory");
+}
+
+inline void clobberMemory() {
+    asm volatile("" : : : "memory");
+}
+
+#else
+
+void benchmarkEscape(const void *pointer);
+
+template<typename T>
+inline void doNotOptimize(const T &value) {
+    benchmarkEscape(&value);
+}
+
+inline void clobberMemory() {
+    benchmarkEscape(nullptr);
+}
+
+#endif
+
+
+// Настройки замеров, общие для всех сценариев (меняются командой chopts)
+struct BenchmarkOptions {
+    size_t warmup_runs = 1;         // прогоны до калибровки, не попадают в статистику
+    size_t repetitions = 10;        // число замеров (выборок)
+    size_t min_repetitions = 3;     // столько выборок делается даже при исчерпании бюджета
+    double min_sample_ms = 10;      // минимальная длительность одной выборки (подбор числа итераций)
+    double budget_ms = 3000;        // ориентировочное время на один сценарий
+    int cpu = -1;                   // номер ядра для привязки потока, -1 - без привязки
+    std::string output_path;        // файл для записей результатов (.csv - CSV, иначе JSON Lines), пусто - не писать
+    bool count_allocations = false; // после выборок - ещё один вызов тела с подсчётом выделений (вне замера)
+    bool perf_counters = false;     // после выборок - ещё одна выборка под аппаратными счётчиками (вне замера)
+};
+
+BenchmarkOptions &benchmarkOptions();
+
+
+// Описание сценария: по container/operation/key_type/size записи сопоставляются в benchcompare
+struct BenchmarkCase {
+    std::string container;
+    std::string operation;
+    std::string key_type;
+    size_t size = 0;                // N - размер входных данных
+    std::string label;              // подпись в текстовом выводе, по умолчанию - container
+
+    [[nodiscard]] const std::string &displayName() const {
+        return label.empty() ? container : label;
+    }
+};
+
+
+// Результат сценария; времена - на одну итерацию тела (вызов body)
+struct BenchmarkResult {
+    std::string suite;
+    BenchmarkCase info;
+    size_t items = 1;               // элементов, обработанных за итерацию (для ns/op)
+    size_t iterations = 0;          // итераций в одной выборке
+    size_t repetitions = 0;
+    double median_ns = 0;
+    double p95_ns = 0;
+    double mean_ns = 0;
+    double stddev_ns = 0;
+    double min_ns = 0;
+    long long allocations = -1;     // выделений за один вызов тела, -1 - не измерялось
+    long long allocated_bytes = -1;
+    long long peak_bytes = -1;      // пик живых байт во время вызова, -1 - не измерялось
+    size_t rss_bytes = 0;           // резидентная память процесса после последнего вызова тела
+    PerfReading perf;               // аппаратные счётчики на один вызов тела
+    bool truncated = false;         // один вызов превысил бюджет: единственная выборка, без проб
+
+    [[nodiscard]] double nsPerItem() const {
+        return median_ns / static_cast<double>(items);
+    }
+};
+
+BenchmarkResult summarizeSamples(const BenchmarkCase &info, size_t items, size_t iterations,
+                                 std::vector<double> samples);
+
+std::string formatDuration(double ns);
+
+// Показатель k в зависимости time ~ c * size^k: наклон МНК-прямой в логарифмических осях.
+// NaN, если различных положительных точек меньше двух
+double fitScalingExponent(const std::vector<double> &sizes, const std::vector<double> &times);
+
+// Текущий размер резидентной памяти процесса, 0 - если недоступно
+size_t currentRssBytes();
+
+// Медианная цена пары вызовов steady_clock::now(), вычитается из задержек отдельных операций
+double clockOverheadNs();
+
+// "p50 41.0 ns, p90 55.0 ns, p99 120 ns, p99.9 2.10 us, max 35.0 us"
+std::string formatLatencyPercentiles(const LatencyHistogram &histogram);
+
+// Задержка каждого вызова op(i), i в [0, count), под отдельным замером (за вычетом цены часов).
+// Нужна для хвостов распределения: перестройки, длинные цепочки, которые теряются в среднем по выборке
+template<typename Op>
+LatencyHistogram sampleLatencies(size_t count, Op op) {
+    using Clock = std::chrono::steady_clock;
+    double overhead = clockOverheadNs();
+    LatencyHistogram histogram;
+    for (size_t i = 0; i < count; ++i) {
+        clobberMemory();
+        auto start = Clock::now();
+        op(i);
+        clobberMemory();
+        auto end = Clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() - overhead;
+        histogram.record(ns > 0 ? static_cast<uint64_t>(ns) : 0);
+    }
+    return histogram;
+}
+
+
+// Набор сценариев: печатает заголовок, на время жизни привязывает поток к ядру (если задано)
+// и собирает результаты. Каждая выборка - iterations вызовов тела; iterations подбирается так,
+// чтобы выборка длилась не меньше min_sample_ms. Результат - медиана, p95 и разброс времени
+// одного вызова по выборкам.
+class BenchmarkSuite {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    std::string title;
+    std::ostream &out;
+    std::vector<BenchmarkResult> collected;
+    bool pinned;
+    bool capture_rss;               // снять RSS после следующего вызова тела (последняя выборка)
+    size_t observed_rss;
+    bool probe_allocations;         // следующий вызов тела - под AllocationScope
+    AllocationStats observed_allocations;
+    std::unique_ptr<PerfCounters> perf;
+    bool probe_perf;                // счётчики включаются только вокруг вызовов тела
+
+    void perfStart() {
+        if (probe_perf) {
+            perf->start();
+        }
+    }
+
+    void perfStop() {
+        if (probe_perf) {
+            perf->stop();
+        }
+    }
+
+    void observeRss() {
+        if (capture_rss) {
+            observed_rss = currentRssBytes();
+            capture_rss = false;
+        }
+    }
+
+    template<typename Call>
+    void invokeBody(Call &&call) {
+        if (probe_allocations) {
+            AllocationScope scope;
+            call();
+            observed_allocations = scope.stats();
+            probe_allocations = false;
+        } else {
+            call();
+        }
+    }
+
+    // Сэмплер: sample(iterations) возвращает суммарное время iterations вызовов тела в наносекундах
+    template<typename Sampler>
+    const BenchmarkResult &measure(const BenchmarkCase &info, size_t items, Sampler sample) {
+        const BenchmarkOptions &options = benchmarkOptions();
+        double min_sample_ns = options.min_sample_ms * 1e6;
+        double budget_ns = options.budget_ms * 1e6;
+        std::vector<double> samples;
+        size_t iterations = 1;
+        observed_rss = 0;
+
+        // Один вызов дольше бюджета (например, remove с конца ListSequence на 200000 элементах) -
+        // сценарий усекается: этот вызов становится единственной выборкой, повторы и пробы не запускаются
+        for (size_t i = 0; i < options.warmup_runs; ++i) {
+            capture_rss = true;
+            auto warmup_start = Clock::now();
+            double warmup = sample(1);
+            if (std::chrono::duration<double, std::nano>(Clock::now() - warmup_start).count() >= budget_ns) {
+                samples.push_back(warmup);
+                return finish(info, items, iterations, std::move(samples), true);
+            }
+        }
+
+        // Калибровка: увеличиваем число итераций, пока выборка короче min_sample_ms.
+        // Бюджет считается по полному времени выборки, вместе с setup
+        capture_rss = true;
+        auto wall_start = Clock::now();
+        double elapsed = sample(iterations);
+        double wall = std::chrono::duration<double, std::nano>(Clock::now() - wall_start).count();
+        if (wall >= budget_ns) {
+            samples.push_back(elapsed);
+            return finish(info, items, iterations, std::move(samples), true);
+        }
+        while (elapsed < min_sample_ns && wall * static_cast<double>(options.min_repetitions) < budget_ns) {
+            double scale = elapsed > 0 ? min_sample_ns / elapsed * 1.2 : 10;
+            size_t next = static_cast<size_t>(static_cast<double>(iterations) * std::min(scale, 10.0));
+            iterations = std::max(next, iterations + 1);
+            wall_start = Clock::now();
+            elapsed = sample(iterations);
+            wall = std::chrono::duration<double, std::nano>(Clock::now() - wall_start).count();
+        }
+
+        size_t repetitions = options.repetitions;
+        if (wall * static_cast<double>(repetitions) > budget_ns) {
+            size_t affordable = static_cast<size_t>(budget_ns / wall);
+            repetitions = std::max(affordable, std::min(options.min_repetitions, options.repetitions));
+        }
+
+        samples.reserve(repetitions);
+        for (size_t i = 0; i < repetitions; ++i) {
+            capture_rss = i + 1 == repetitions;
+            samples.push_back(sample(iterations) / static_cast<double>(iterations));
+        }
+
+        finish(info, items, iterations, std::move(samples), false);
+        if (options.count_allocations) {
+            probe_allocations = true;
+            sample(1);
+            collected.back().allocations = static_cast<long long>(observed_allocations.count);
+            collected.back().allocated_bytes = static_cast<long long>(observed_allocations.bytes);
+            collected.back().peak_bytes = static_cast<long long>(observed_allocations.peak_bytes);
+        }
+        if (perf && perf->available()) {
+            perf->reset();
+            probe_perf = true;
+            sample(iterations);
+            probe_perf = false;
+            collected.back().perf = perf->read().scaled(static_cast<double>(iterations));
+        }
+        report(collected.back());
+        return collected.back();
+    }
+
+    // Сохраняет результат; усечённый сценарий сразу печатается, без проб выделений и счётчиков
+    const BenchmarkResult &finish(const BenchmarkCase &info, size_t items, size_t iterations,
+                                  std::vector<double> samples, bool truncated) {
+        capture_rss = false;
+        collected.push_back(summarizeSamples(info, items, iterations, std::move(samples)));
+        collected.back().suite = title;
+        collected.back().rss_bytes = observed_rss;
+        collected.back().truncated = truncated;
+        if (truncated) {
+            report(collected.back());
+        }
+        return collected.back();
+    }
+
+    void report(const BenchmarkResult &result);
+
+public:
+    // out - куда печатать заголовок и результаты (из фонового потока - в свой буфер, а не в std::cout)
+    explicit BenchmarkSuite(const std::string &title, std::ostream &out = std::cout);
+
+    ~BenchmarkSuite();
+
+    BenchmarkSuite(const BenchmarkSuite &) = delete;
+
+    BenchmarkSuite &operator=(const BenchmarkSuite &) = delete;
+
+    // Каждый вызов body получает свежее состояние от setup; замеряется только body
+    template<typename Setup, typename Body>
+    const BenchmarkResult &run(const BenchmarkCase &info, size_t items, Setup setup, Body body) {
+        return measure(info, items, [this, &setup, &body](size_t iterations) {
+            double total = 0;
+            for (size_t i = 0; i < iterations; ++i) {
+                auto state = setup();
+                clobberMemory();
+                auto start = Clock::now();
+                perfStart();
+                invokeBody([&body, &state] { body(state); });
+                clobberMemory();
+                perfStop();
+                auto end = Clock::now();
+                total += std::chrono::duration<double, std::nano>(end - start).count();
+                observeRss();
+            }
+            return total;
+        });
+    }
+
+    // Тело без подготовки: все вызовы выборки идут под одним замером, без накладных расходов часов
+    template<typename Body>
+    const BenchmarkResult &run(const BenchmarkCase &info, size_t items, Body body) {
+        return measure(info, items, [this, &body](size_t iterations) {
+            auto start = Clock::now();
+            perfStart();
+            for (size_t i = 0; i < iterations; ++i) {
+                invokeBody(body);
+                clobberMemory();
+            }
+            perfStop();
+            auto end = Clock::now();
+            observeRss();
+            return std::chrono::duration<double, std::nano>(end - start).count();
+        });
+    }
+
+    // Строка-разделитель между группами сценариев
+    void section(const std::string &heading);
+
+    [[nodiscard]] const std::vector<BenchmarkResult> &results() const {
+        return collected;
+    }
+};
\ No newline at end of file
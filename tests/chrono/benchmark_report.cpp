@@ -0,0 +1,407 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include "benchmark_report.hpp"
+
+
+namespace {
+    const char *const record_fields[] = {
+            "suite", "container", "operation", "key_type", "n", "items", "iterations", "repetitions",
+            "median_ns", "p95_ns", "mean_ns", "stddev_ns", "min_ns", "ns_per_op", "allocations", "alloc_bytes",
+            "peak_bytes", "rss_bytes", "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses",
+            "dtlb_misses"
+    };
+
+    bool isCsv(const std::string &path) {
+        return path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0;
+    }
+
+    std::string formatNumber(double value) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.6g", value);
+        return buffer;
+    }
+
+    std::string optionalNumber(long long value) {
+        return value < 0 ? std::string() : std::to_string(value);
+    }
+
+    std::string optionalNumber(double value) {
+        return value < 0 ? std::string() : formatNumber(value);
+    }
+
+    // Значения полей записи в порядке record_fields; числа - уже в текстовом виде
+    std::vector<std::string> recordValues(const BenchmarkResult &result) {
+        return {
+                result.suite, result.info.container, result.info.operation, result.info.key_type,
+                std::to_string(result.info.size), std::to_string(result.items), std::to_string(result.iterations),
+                std::to_string(result.repetitions), formatNumber(result.median_ns), formatNumber(result.p95_ns),
+                formatNumber(result.mean_ns), formatNumber(result.stddev_ns), formatNumber(result.min_ns),
+                formatNumber(result.nsPerItem()),
+                optionalNumber(result.allocations), optionalNumber(result.allocated_bytes),
+                optionalNumber(result.peak_bytes), std::to_string(result.rss_bytes),
+                optionalNumber(result.perf.cycles), optionalNumber(result.perf.instructions),
+                optionalNumber(result.perf.l1d_misses), optionalNumber(result.perf.llc_misses),
+                optionalNumber(result.perf.branch_misses), optionalNumber(result.perf.dtlb_misses)
+        };
+    }
+
+    bool isTextField(size_t index) {
+        return index < 4;
+    }
+
+    std::string jsonEscape(const std::string &text) {
+        std::string escaped;
+        for (char c: text) {
+            if (c == '"' || c == '\\') {
+                escaped += '\\';
+                escaped += c;
+            } else if (c == '\n') {
+                escaped += "\\n";
+            } else {
+                escaped += c;
+            }
+        }
+        return escaped;
+    }
+
+    std::string csvQuote(const std::string &text) {
+        std::string quoted = "\"";
+        for (char c: text) {
+            if (c == '"') {
+                quoted += '"';
+            }
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+
+    // Разбор плоского JSON-объекта из одной строки: строки, числа и null
+    std::map<std::string, std::string> parseJsonLine(const std::string &line) {
+        std::map<std::string, std::string> fields;
+        size_t pos = 0;
+        auto skipSpaces = [&] {
+            while (pos < line.size() && std::isspace(static_cast<unsigned char>(line[pos]))) {
+                ++pos;
+            }
+        };
+        auto expect = [&](char c) {
+            skipSpaces();
+            if (pos >= line.size() || line[pos] != c) {
+                throw std::runtime_error(std::string("expected '") + c + "'");
+            }
+            ++pos;
+        };
+        auto parseString = [&] {
+            expect('"');
+            std::string value;
+            while (pos < line.size() && line[pos] != '"') {
+                if (line[pos] == '\\' && pos + 1 < line.size()) {
+                    ++pos;
+                    value += line[pos] == 'n' ? '\n' : line[pos];
+                } else {
+                    value += line[pos];
+                }
+                ++pos;
+            }
+            expect('"');
+            return value;
+        };
+
+        expect('{');
+        skipSpaces();
+        if (pos < line.size() && line[pos] == '}') {
+            return fields;
+        }
+        while (true) {
+            std::string key = parseString();
+            expect(':');
+            skipSpaces();
+            if (pos < line.size() && line[pos] == '"') {
+                fields[key] = parseString();
+            } else {
+                size_t start = pos;
+                while (pos < line.size() && line[pos] != ',' && line[pos] != '}' &&
+                       !std::isspace(static_cast<unsigned char>(line[pos]))) {
+                    ++pos;
+                }
+                std::string value = line.substr(start, pos - start);
+                fields[key] = value == "null" ? std::string() : value;
+            }
+            skipSpaces();
+            if (pos < line.size() && line[pos] == ',') {
+                ++pos;
+                continue;
+            }
+            expect('}');
+            return fields;
+        }
+    }
+
+    std::vector<std::string> parseCsvLine(const std::string &line) {
+        std::vector<std::string> values;
+        std::string value;
+        bool quoted = false;
+        for (size_t i = 0; i < line.size(); ++i) {
+            char c = line[i];
+            if (quoted) {
+                if (c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+                    value += '"';
+                    ++i;
+                } else if (c == '"') {
+                    quoted = false;
+                } else {
+                    value += c;
+                }
+            } else if (c == '"') {
+                quoted = true;
+            } else if (c == ',') {
+                values.push_back(value);
+                value.clear();
+            } else if (c != '\r') {
+                value += c;
+            }
+        }
+        values.push_back(value);
+        return values;
+    }
+
+    BenchmarkResult recordFromFields(const std::map<std::string, std::string> &fields) {
+        auto text = [&fields](const char *name) {
+            auto it = fields.find(name);
+            return it == fields.end() ? std::string() : it->second;
+        };
+        auto number = [&text](const char *name) {
+            std::string value = text(name);
+            return value.empty() ? 0.0 : std::strtod(value.c_str(), nullptr);
+        };
+        auto optional = [&text, &number](const char *name) {
+            return text(name).empty() ? -1 : static_cast<long long>(number(name));
+        };
+
+        BenchmarkResult result;
+        result.suite = text("suite");
+        result.info.container = text("container");
+        result.info.operation = text("operation");
+        result.info.key_type = text("key_type");
+        result.info.size = static_cast<size_t>(number("n"));
+        result.items = std::max<size_t>(static_cast<size_t>(number("items")), 1);
+        result.iterations = static_cast<size_t>(number("iterations"));
+        result.repetitions = static_cast<size_t>(number("repetitions"));
+        result.median_ns = number("median_ns");
+        result.p95_ns = number("p95_ns");
+        result.mean_ns = number("mean_ns");
+        result.stddev_ns = number("stddev_ns");
+        result.min_ns = number("min_ns");
+        result.allocations = optional("allocations");
+        result.allocated_bytes = optional("alloc_bytes");
+        result.peak_bytes = optional("peak_bytes");
+        result.rss_bytes = static_cast<size_t>(number("rss_bytes"));
+        auto counter = [&text, &number](const char *name) {
+            return text(name).empty() ? -1.0 : number(name);
+        };
+        result.perf.cycles = counter("cycles");
+        result.perf.instructions = counter("instructions");
+        result.perf.l1d_misses = counter("l1d_misses");
+        result.perf.llc_misses = counter("llc_misses");
+        result.perf.branch_misses = counter("branch_misses");
+        result.perf.dtlb_misses = counter("dtlb_misses");
+        return result;
+    }
+
+    // Один и тот же контейнер встречается в разных наборах (std::vector<int> - в seq и arrseq),
+    // поэтому набор входит в ключ
+    std::string caseKey(const BenchmarkResult &result) {
+        return result.suite + '\x1f' + result.info.container + '\x1f' + result.info.operation + '\x1f' + result.info.key_type + '\x1f' +
+               std::to_string(result.info.size);
+    }
+
+    double relativeSpread(const BenchmarkResult &result) {
+        return result.mean_ns > 0 ? result.stddev_ns / result.mean_ns : 0;
+    }
+
+    std::string caseTitle(const BenchmarkResult &result) {
+        std::string title = result.info.container + " " + result.info.operation;
+        if (!result.info.key_type.empty()) {
+            title += " <" + result.info.key_type + ">";
+        }
+        title += " n=" + std::to_string(result.info.size);
+        if (!result.suite.empty()) {
+            title += " (" + result.suite + ")";
+        }
+        return title;
+    }
+
+    // Повторы ключа в одном файле (несколько запусков с --out в один файл) не теряются молча:
+    // каждый печатается предупреждением, в сравнение идёт последняя запись
+    std::map<std::string, BenchmarkResult> recordsByCase(const std::string &path, size_t &duplicates) {
+        std::map<std::string, BenchmarkResult> records;
+        for (const BenchmarkResult &record: readBenchmarkRecords(path)) {
+            auto [it, inserted] = records.insert_or_assign(caseKey(record), record);
+            if (!inserted) {
+                ++duplicates;
+                std::cerr << "Warning: " << path << ": duplicate record for " << caseTitle(it->second)
+                          << ", the last one is used" << std::endl;
+            }
+        }
+        return records;
+    }
+}
+
+bool writeBenchmarkRecord(const std::string &path, const BenchmarkResult &result) {
+    bool csv = isCsv(path);
+    bool fresh;
+    {
+        std::ifstream existing(path, std::ios::binary | std::ios::ate);
+        fresh = !existing || existing.tellg() == 0;
+    }
+    std::ofstream file(path, std::ios::app);
+    if (!file) {
+        return false;
+    }
+
+    std::vector<std::string> values = recordValues(result);
+    constexpr size_t field_count = sizeof(record_fields) / sizeof(record_fields[0]);
+    if (csv) {
+        if (fresh) {
+            for (size_t i = 0; i < field_count; ++i) {
+                file << (i ? "," : "") << record_fields[i];
+            }
+            file << "\n";
+        }
+        for (size_t i = 0; i < field_count; ++i) {
+            file << (i ? "," : "") << (isTextField(i) ? csvQuote(values[i]) : values[i]);
+        }
+    } else {
+        file << "{";
+        for (size_t i = 0; i < field_count; ++i) {
+            file << (i ? ", " : "") << "\"" << record_fields[i] << "\": ";
+            if (isTextField(i)) {
+                file << "\"" << jsonEscape(values[i]) << "\"";
+            } else {
+                file << (values[i].empty() ? "null" : values[i]);
+            }
+        }
+        file << "}";
+    }
+    file << "\n";
+    return static_cast<bool>(file);
+}
+
+std::vector<BenchmarkResult> readBenchmarkRecords(const std::string &path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    bool csv = isCsv(path);
+    std::vector<BenchmarkResult> records;
+    std::vector<std::string> header;
+    std::string line;
+    size_t line_number = 0;
+    while (std::getline(file, line)) {
+        ++line_number;
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+        try {
+            if (csv) {
+                std::vector<std::string> values = parseCsvLine(line);
+                if (header.empty()) {
+                    header = values;
+                    continue;
+                }
+                if (values.size() != header.size()) {
+                    throw std::runtime_error("expected " + std::to_string(header.size()) + " fields");
+                }
+                std::map<std::string, std::string> fields;
+                for (size_t i = 0; i < header.size(); ++i) {
+                    fields[header[i]] = values[i];
+                }
+                records.push_back(recordFromFields(fields));
+            } else {
+                records.push_back(recordFromFields(parseJsonLine(line)));
+            }
+        } catch (const std::runtime_error &error) {
+            throw std::runtime_error(path + ":" + std::to_string(line_number) + ": " + error.what());
+        }
+    }
+    return records;
+}
+
+BenchmarkComparison compareBenchmarks(const std::string &baseline_path, const std::string &current_path,
+                                      double threshold) {
+    BenchmarkComparison comparison;
+    std::map<std::string, BenchmarkResult> baseline = recordsByCase(baseline_path, comparison.duplicates);
+    std::map<std::string, BenchmarkResult> current = recordsByCase(current_path, comparison.duplicates);
+
+    for (const auto &[key, before]: baseline) {
+        auto found = current.find(key);
+        if (found == current.end()) {
+            ++comparison.missing;
+            std::cout << "  MISSING     " << caseTitle(before) << std::endl;
+            continue;
+        }
+        const BenchmarkResult &after = found->second;
+        ++comparison.compared;
+        double old_ns = before.nsPerItem();
+        double new_ns = after.nsPerItem();
+        double change = old_ns > 0 ? new_ns / old_ns - 1 : 0;
+        // Изменение в пределах двух стандартных отклонений любого из замеров считается шумом
+        double noise = std::max(relativeSpread(before), relativeSpread(after));
+        double limit = std::max(threshold, 2 * noise);
+        const char *verdict = "  ok          ";
+        if (change > limit) {
+            verdict = "  REGRESSION  ";
+            ++comparison.regressions;
+        } else if (change < -limit) {
+            verdict = "  improvement ";
+            ++comparison.improvements;
+        }
+        char percent[16];
+        std::snprintf(percent, sizeof(percent), "%+.1f%%", change * 100);
+        std::cout << verdict << caseTitle(after) << ": " << formatDuration(old_ns) << "/op -> "
+                  << formatDuration(new_ns) << "/op (" << percent;
+        if (limit > threshold) {
+            std::cout << ", noise " << static_cast<int>(noise * 100 + 0.5) << "%";
+        }
+        std::cout << ")";
+        // Число выделений детерминировано, поэтому любое его изменение показывается
+        if (before.allocations >= 0 && after.allocations >= 0 && before.allocations != after.allocations) {
+            std::cout << ", allocs " << before.allocations << " -> " << after.allocations;
+        }
+        std::cout << std::endl;
+    }
+    for (const auto &[key, after]: current) {
+        if (!baseline.count(key)) {
+            std::cout << "  new         " << caseTitle(after) << std::endl;
+        }
+    }
+
+    std::cout << comparison.compared << " compared, " << comparison.regressions << " regressions, "
+              << comparison.improvements << " improvements, " << comparison.missing << " missing";
+    if (comparison.duplicates) {
+        std::cout << ", " << comparison.duplicates << " duplicate records";
+    }
+    std::cout << " (threshold " << threshold * 100 << "%)" << std::endl;
+    return comparison;
+}
+
+int benchCompareMain(int argc, char *argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: benchcompare <baseline> <current> [threshold%]" << std::endl;
+        return 2;
+    }
+    double threshold = argc > 3 ? std::strtod(argv[3], nullptr) / 100 : 0.05;
+    try {
+        return compareBenchmarks(argv[1], argv[2], threshold).regressions ? 1 : 0;
+    } catch (const std::runtime_error &error) {
+        std::cerr << "Error: " << error.what() << std::endl;
+        return 2;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+
+
+// Машиночитаемые результаты замеров. Формат выбирается по расширению файла:
+// .csv - CSV с заголовком, иначе JSON Lines (один объект на строку).
+// Записи дописываются в конец файла, поэтому несколько запусков копятся в одном файле.
+
+bool writeBenchmarkRecord(const std::string &path, const BenchmarkResult &result);
+
+// Читает записи из файла; при ошибке формата бросает std::runtime_error с номером строки
+std::vector<BenchmarkResult> readBenchmarkRecords(const std::string &path);
+
+
+// Сравнение двух файлов результатов по median ns/op. Сценарии сопоставляются по
+// suite/container/operation/key_type/size; при повторах в файле печатается предупреждение
+// и берётся последняя запись.
+struct BenchmarkComparison {
+    size_t compared = 0;
+    size_t regressions = 0;
+    size_t improvements = 0;
+    size_t missing = 0;             // есть в базовом файле, нет в новом
+    size_t duplicates = 0;          // записей, перекрытых более поздней с тем же ключом (в обоих файлах)
+};
+
+// threshold - допустимое относительное изменение (0.05 - 5%); если разброс выборок больше,
+// порогом служат два относительных стандартных отклонения. Печатает таблицу в stdout
+BenchmarkComparison compareBenchmarks(const std::string &baseline_path, const std::string &current_path,
+                                      double threshold);
+
+// Точка входа для командной строки: benchcompare <baseline> <current> [threshold%] (argv[0] - имя команды).
+// Код возврата: 0 - без регрессий, 1 - есть регрессии, 2 - ошибка аргументов или файлов
+int benchCompareMain(int argc, char *argv[]);
\ No newline at end of file
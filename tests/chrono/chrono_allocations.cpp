@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <iostream>
+#include <list>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "chrono_allocations.hpp"
+#include "allocation_counter.hpp"
+#include "benchmark.hpp"
+#include "../../include/array_sequence.hpp"
+#include "../../include/list_sequence.hpp"
+#include "../../include/hash_table.hpp"
+#include "../../include/hash_set.hpp"
+#include "../../include/graph_generator.hpp"
+#include "../../include/calc_algs.hpp"
+
+
+using namespace std;
+
+void chronoAllocationLine(const string &name, const AllocationStats &stats) {
+    cout << "  " << name << ": " << formatAllocationStats(stats);
+    if (allocationPeakSupported()) {
+        cout << ", retained " << formatBytes(static_cast<double>(stats.live_bytes));
+    }
+    cout << endl;
+}
+
+// Один вызов под глобальным перехватом; результат живёт до конца области и попадает в retained
+template<typename Call>
+void chronoAllocationCall(const string &name, Call call) {
+    AllocationScope scope;
+    auto result = call();
+    doNotOptimize(result);
+    chronoAllocationLine(name, scope.stats());
+}
+
+// std-контейнер со своим CountingAllocator: статистика только его собственных выделений
+template<typename Container, typename Fill>
+void chronoAllocatorCall(const string &name, Fill fill) {
+    AllocationStats stats;
+    {
+        Container container{typename Container::allocator_type(stats)};
+        fill(container);
+        doNotOptimize(container);
+        chronoAllocationLine(name, stats);
+    }
+}
+
+void chronoContainerAllocations(size_t num_elements) {
+    int count = static_cast<int>(num_elements);
+    cout << "Containers, " << num_elements << " elements:" << endl;
+
+    chronoAllocationCall("ArraySequence<int>::add", [count] {
+        ArraySequence<int> sequence;
+        for (int i = 0; i < count; ++i) {
+            sequence.add(i);
+        }
+        return sequence;
+    });
+    chronoAllocatorCall<vector<int, CountingAllocator<int>>>("std::vector<int>::push_back", [count](auto &v) {
+        for (int i = 0; i < count; ++i) {
+            v.push_back(i);
+        }
+    });
+
+    chronoAllocationCall("ListSequence<int>::add", [count] {
+        ListSequence<int> sequence;
+        for (int i = 0; i < count; ++i) {
+            sequence.add(i);
+        }
+        return sequence;
+    });
+    chronoAllocatorCall<list<int, CountingAllocator<int>>>("std::list<int>::push_back", [count](auto &l) {
+        for (int i = 0; i < count; ++i) {
+            l.push_back(i);
+        }
+    });
+
+    chronoAllocationCall("HashTable<int, int>::insert (with rebuilds)", [count] {
+        HashTable<int, int> table;
+        for (int i = 0; i < count; ++i) {
+            table.insert(i, i);
+        }
+        return table;
+    });
+    using CountedMap = unordered_map<int, int, hash<int>, equal_to<int>, CountingAllocator<pair<const int, int>>>;
+    chronoAllocatorCall<CountedMap>("std::unordered_map<int, int>::insert", [count](auto &map) {
+        for (int i = 0; i < count; ++i) {
+            map.emplace(i, i);
+        }
+    });
+
+    chronoAllocationCall("HashSet<int>::add", [count] {
+        HashSet<int> set;
+        for (int i = 0; i < count; ++i) {
+            set.add(i);
+        }
+        return set;
+    });
+    chronoAllocatorCall<set<int, less<int>, CountingAllocator<int>>>("std::set<int>::insert", [count](auto &s) {
+        for (int i = 0; i < count; ++i) {
+            s.insert(i);
+        }
+    });
+    cout << endl;
+}
+
+void chronoGraphAllocations(size_t num_elements) {
+    int vertices = static_cast<int>(std::max<size_t>(num_elements, 2));
+    // В среднем 8 соседей у вершины
+    double probability = std::min(1.0, 8.0 / (vertices - 1));
+    GeneratorContext ctx(42);
+
+    Graph<int> graph;
+    AllocationStats generation;
+    {
+        AllocationScope scope;
+        graph = generateRandomGraph<int>(vertices, probability, 1, 100, ctx);
+        generation = scope.stats();
+    }
+    cout << "Graph, " << graph.getVertexCount() << " vertices, " << graph.getEdgeCount() << " edges:" << endl;
+    chronoAllocationLine("generateRandomGraph", generation);
+
+    chronoAllocationCall("Graph::getEdges()", [&graph] { return graph.getEdges(); });
+    chronoAllocationCall("Graph::getAdjacencyList()", [&graph] { return graph.getAdjacencyList(); });
+    chronoAllocationCall("Graph::getNeighbors()", [&graph] { return graph.getNeighbors(0); });
+    chronoAllocationCall("greedyColoring", [&graph] { return greedyColoring(graph); });
+    chronoAllocationCall("kruskal", [&graph] { return kruskal(graph); });
+    chronoAllocationCall("dijkstra", [&graph, vertices] { return dijkstra(graph, 0, vertices - 1); });
+    cout << endl;
+}
+
+void chronoAllocations(size_t num_elements) {
+    cout << "Allocation profile (operator new calls, requested bytes, peak live bytes)" << endl << endl;
+    chronoContainerAllocations(num_elements);
+    chronoGraphAllocations(num_elements);
+}
\ No newline at end of file
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <cstddef>
+
+
+// Профиль выделений памяти: заполнение контейнеров (std-контейнеры - через CountingAllocator)
+// и по одному вызову операций графа на случайном графе из num_elements вершин
+void chronoAllocations(size_t num_elements);
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <iterator>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include "chrono_graph.hpp"
+#include "benchmark.hpp"
+
+
+using namespace std;
+
+const char *const chrono_graph_families[] = {"chain", "cycle", "complete", "random"};
+
+int chronoFamilyVertices(const string &family, size_t vertices) {
+    if (family == "complete") {
+        return max(4, static_cast<int>(sqrt(8.0 * static_cast<double>(vertices))));
+    }
+    return static_cast<int>(max<size_t>(vertices, 4));
+}
+
+Graph<int> chronoGenerateGraph(const string &family, int vertices) {
+    GeneratorContext ctx(42);
+    if (family == "chain") {
+        return generateChainGraph<int>(vertices, 1, 100, ctx);
+    } else if (family == "cycle") {
+        return generateCycleGraph<int>(vertices, 1, 100, ctx);
+    } else if (family == "complete") {
+        return generateCompleteGraph<int>(vertices, 1, 100, ctx);
+    } else if (family == "random") {
+        // В среднем 8 соседей у вершины
+        return generateRandomGraph<int>(vertices, min(1.0, 8.0 / (vertices - 1)), 1, 100, ctx);
+    }
+    throw invalid_argument("Unknown graph family '" + family + "' (chain, cycle, complete, random)");
+}
+
+// Замеры одного графа; результаты - в series в порядке операций
+void chronoGraphSize(BenchmarkSuite &suite, const string &family, int vertices,
+                     vector<GraphScalingSeries> &series) {
+    Graph<int> graph = chronoGenerateGraph(family, vertices);
+    size_t edges = graph.getEdgeCount();
+    string container = "Graph<int> " + family;
+    auto graphCase = [&](const string &operation) {
+        return BenchmarkCase{container, operation, "int", static_cast<size_t>(vertices), operation};
+    };
+    // Мутации: k операций на копии графа, копирование в замер не входит
+    int additions = min(256, vertices / 2);
+    int removals = min(64, vertices / 2);
+
+    suite.section(family + " graph, " + to_string(vertices) + " vertices, " + to_string(edges) + " edges");
+    vector<BenchmarkResult> results;
+    results.push_back(suite.run(graphCase("generate"), 1, [&family, vertices] {
+        Graph<int> generated = chronoGenerateGraph(family, vertices);
+        doNotOptimize(generated);
+    }));
+    results.push_back(suite.run(graphCase("dijkstra"), 1, [&graph, vertices] {
+        auto path = dijkstra(graph, 0, vertices - 1);
+        doNotOptimize(path);
+    }));
+    results.push_back(suite.run(graphCase("kruskal"), 1, [&graph] {
+        auto mst = kruskal(graph);
+        doNotOptimize(mst);
+    }));
+    results.push_back(suite.run(graphCase("greedyColoring"), 1, [&graph] {
+        auto colors = greedyColoring(graph);
+        doNotOptimize(colors);
+    }));
+    results.push_back(suite.run(graphCase("addEdge"), additions, [&graph] { return graph; },
+                                 [additions, vertices](Graph<int> &copy) {
+                                     for (int i = 0; i < additions; ++i) {
+                                         copy.addEdge(i, (i + vertices / 2) % vertices, 1);
+                                     }
+                                     doNotOptimize(copy);
+                                 }));
+    results.push_back(suite.run(graphCase("removeVertex"), removals, [&graph] { return graph; },
+                                 [removals](Graph<int> &copy) {
+                                     for (int i = 0; i < removals; ++i) {
+                                         copy.removeVertex(i);
+                                     }
+                                     doNotOptimize(copy);
+                                 }));
+
+    series.resize(results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+        series[i].operation = results[i].info.operation;
+        series[i].vertices.push_back(static_cast<size_t>(vertices));
+        series[i].edges.push_back(edges);
+        series[i].ms_per_op.push_back(results[i].nsPerItem() / 1e6);
+        series[i].ms_stddev.push_back(results[i].stddev_ns / static_cast<double>(results[i].items) / 1e6);
+    }
+}
+
+bool isChronoGraphFamily(const string &family) {
+    return find(begin(chrono_graph_families), end(chrono_graph_families), family) != end(chrono_graph_families);
+}
+
+// Размеры от max_vertices / 16 до max_vertices без повторов
+vector<int> chronoGraphSizes(const string &family, size_t max_vertices) {
+    vector<int> sizes;
+    for (size_t divisor = 16; divisor >= 1; divisor /= 2) {
+        int vertices = chronoFamilyVertices(family, max_vertices / divisor);
+        if (sizes.empty() || sizes.back() != vertices) {
+            sizes.push_back(vertices);
+        }
+    }
+    return sizes;
+}
+
+size_t chronoGraphSizeCount(const string &family, size_t max_vertices) {
+    return chronoGraphSizes(family, max_vertices).size();
+}
+
+vector<GraphScalingSeries> chronoGraphScaling(const string &family, size_t max_vertices,
+                                              const GraphScalingObserver &on_size, ostream &out) {
+    // Проверка имени до запуска замеров
+    chronoGenerateGraph(family, 4);
+
+    BenchmarkSuite suite("Graph algorithms on " + family + " graphs", out);
+    vector<GraphScalingSeries> series;
+    for (int vertices: chronoGraphSizes(family, max_vertices)) {
+        chronoGraphSize(suite, family, vertices, series);
+        if (on_size && !on_size(series)) {
+            break;
+        }
+    }
+
+    out << endl << "Scaling of time per operation (time ~ V^a, time ~ E^b):" << endl;
+    for (GraphScalingSeries &line: series) {
+        vector<double> vertices(line.vertices.begin(), line.vertices.end());
+        vector<double> edges(line.edges.begin(), line.edges.end());
+        line.vertex_exponent = fitScalingExponent(vertices, line.ms_per_op);
+        line.edge_exponent = fitScalingExponent(edges, line.ms_per_op);
+        char buffer[96];
+        snprintf(buffer, sizeof(buffer), "  %-16s a = %5.2f, b = %5.2f", line.operation.c_str(),
+                 line.vertex_exponent, line.edge_exponent);
+        out << buffer << endl;
+    }
+    return series;
+}
+
+void chronoGraph(size_t max_vertices) {
+    for (const char *family: chrono_graph_families) {
+        chronoGraphScaling(family, max_vertices);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../include/graph_generator.hpp"
+#include "../../include/calc_algs.hpp"
+
+
+// Зависимость времени одной операции от размера графа: точки для графика и оценка степени
+struct GraphScalingSeries {
+    std::string operation;
+    std::vector<size_t> vertices;
+    std::vector<size_t> edges;
+    std::vector<double> ms_per_op;  // медиана на одну операцию (вызов алгоритма, addEdge, removeVertex)
+    std::vector<double> ms_stddev;  // стандартное отклонение по выборкам, на одну операцию
+    double vertex_exponent = 0;     // time ~ V^vertex_exponent
+    double edge_exponent = 0;       // time ~ E^edge_exponent
+};
+
+// Семейство графов (chain, cycle, complete, random) на пяти размерах от max_vertices / 16 до max_vertices:
+// генерация, dijkstra, kruskal, greedyColoring, addEdge и removeVertex. Полный граф берётся с таким числом
+// вершин, чтобы рёбер было примерно 4V, как у случайного графа.
+// on_size вызывается после каждого размера с уже накопленными рядами (для живого графика);
+// false - остановить замеры, степени считаются по готовым точкам. Таблица результатов печатается в out
+using GraphScalingObserver = std::function<bool(const std::vector<GraphScalingSeries> &)>;
+
+std::vector<GraphScalingSeries> chronoGraphScaling(const std::string &family, size_t max_vertices,
+                                                   const GraphScalingObserver &on_size = nullptr,
+                                                   std::ostream &out = std::cout);
+
+// Число размеров, которые замеряет chronoGraphScaling (одинаковые после округления пропускаются)
+size_t chronoGraphSizeCount(const std::string &family, size_t max_vertices);
+
+bool isChronoGraphFamily(const std::string &family);
+
+// Все семейства подряд
+void chronoGraph(size_t max_vertices);
\ No newline at end of file
@@ -1,184 +1,122 @@
 #include <iostream>
-#include <chrono>
+#include <string>
 #include <vector>
 #include <unordered_map>
 #include "chrono_hash_table.hpp"
+#include "benchmark.hpp"
 #include "demangle.hpp"
 
 
 using namespace std;
-using namespace chrono;
 
-template<typename K, typename V, typename Container>
-void chronoInsertionTable(size_t elementCount) {
-    Container table;
-    auto start = high_resolution_clock::now();
+template<typename T>
+T chronoTableKey(size_t i) {
+    if constexpr (is_same_v<T, string>) {
+        return to_string(i);
+    } else {
+        return static_cast<T>(i);
+    }
+}
+
+template<typename T>
+vector<T> chronoTableKeys(size_t elementCount) {
+    vector<T> keys;
+    keys.reserve(elementCount);
     for (size_t i = 0; i < elementCount; ++i) {
-        if constexpr (is_same_v<Container, HashTable<K, V>>) {
-            if constexpr (std::is_same_v<K, std::string> && std::is_same_v<V, std::string>) {
-                table.insert(to_string(i), to_string(i));
-            } else if constexpr (std::is_same_v<K, std::string>) {
-                table.insert(to_string(i), i);
-            } else if constexpr (std::is_same_v<V, std::string>) {
-                table.insert(i, to_string(i));
-            } else {
-                table.insert(i, i);
-            }
-        } else {
-            if constexpr (std::is_same_v<K, std::string> && std::is_same_v<V, std::string>) {
-                table[to_string(i)] = to_string(i);
-            } else if constexpr (std::is_same_v<K, std::string>) {
-                table[to_string(i)] = i;
-            } else if constexpr (std::is_same_v<V, std::string>) {
-                table[i] = to_string(i);
-            } else {
-                table[i] = i;
-            }
-        }
+        keys.push_back(chronoTableKey<T>(i));
     }
-    auto end = high_resolution_clock::now();
-    auto duration = duration_cast<milliseconds>(end - start);
-    cout << "Insertion time for " << elementCount << " elements " << demangle(typeid(Container).name()) << ": "
-         << duration.count() << " ms" << endl;
+    return keys;
 }
 
+template<typename T>
+string chronoTypeName() {
+    return is_same_v<T, string> ? "string" : demangle(typeid(T).name());
+}
+
+// key_type записи - "K, V"
 template<typename K, typename V, typename Container>
-void chronoGetTable(size_t elementCount) {
-    Container table;
-    std::vector<K> keys;
-    for (size_t i = 0; i < elementCount; ++i) {
+BenchmarkCase chronoTableCase(const string &operation, const string &title, size_t elementCount) {
+    string container = demangle(typeid(Container).name());
+    return {container, operation, chronoTypeName<K>() + ", " + chronoTypeName<V>(), elementCount,
+            title + " " + container};
+}
+
+template<typename K, typename V, typename Container>
+void chronoTableFill(Container &table, const vector<K> &keys, const vector<V> &values) {
+    for (size_t i = 0; i < keys.size(); ++i) {
         if constexpr (is_same_v<Container, HashTable<K, V>>) {
-            if constexpr (std::is_same_v<K, std::string> && std::is_same_v<V, std::string>) {
-                table.insert(to_string(i), to_string(i));
-                keys.push_back(to_string(i));
-            } else if constexpr (std::is_same_v<K, std::string>) {
-                table.insert(to_string(i), i);
-                keys.push_back(to_string(i));
-            } else if constexpr (std::is_same_v<V, std::string>) {
-                table.insert(i, to_string(i));
-                keys.push_back(i);
-            } else {
-                table.insert(i, i);
-                keys.push_back(i);
-            }
+            table.insert(keys[i], values[i]);
         } else {
-            if constexpr (std::is_same_v<K, std::string> && std::is_same_v<V, std::string>) {
-                table[to_string(i)] = to_string(i);
-                keys.push_back(to_string(i));
-            } else if constexpr (std::is_same_v<K, std::string>) {
-                table[to_string(i)] = i;
-                keys.push_back(to_string(i));
-            } else if constexpr (std::is_same_v<V, std::string>) {
-                table[i] = to_string(i);
-                keys.push_back(i);
-            } else {
-                table[i] = i;
-                keys.push_back(i);
-            }
+            table[keys[i]] = values[i];
         }
     }
-    auto start = chrono::high_resolution_clock::now();
-    if constexpr (is_same_v<Container, HashTable<K, V>>) {
-        for (const auto &key: keys) {
-            table.get(key);
-        }
-    } else {
-        for (const auto &key: keys) {
-            table.at(key);
-        }
-    }
-    auto end = chrono::high_resolution_clock::now();
-    auto duration = chrono::duration_cast<chrono::milliseconds>(end - start);
-    cout << "Get time for " << elementCount << " elements " << demangle(typeid(Container).name()) << ": "
-         << duration.count() << " ms" << endl;
 }
 
 template<typename K, typename V, typename Container>
-void chronoRemovalTable(size_t elementCount) {
+void chronoInsertionTable(BenchmarkSuite &suite, const vector<K> &keys, const vector<V> &values) {
+    suite.run(chronoTableCase<K, V, Container>("insert", "Insertion", keys.size()), keys.size(),
+              [] { return Container(); },
+              [&keys, &values](Container &table) {
+                  chronoTableFill(table, keys, values);
+                  doNotOptimize(table);
+              });
+}
+
+template<typename K, typename V, typename Container>
+void chronoGetTable(BenchmarkSuite &suite, const vector<K> &keys, const vector<V> &values) {
     Container table;
-    std::vector<K> keys;
-    for (size_t i = 0; i < elementCount; ++i) {
-        if constexpr (is_same_v<Container, HashTable<K, V>>) {
-            if constexpr (std::is_same_v<K, std::string> && std::is_same_v<V, std::string>) {
-                table.insert(to_string(i), to_string(i));
-                keys.push_back(to_string(i));
-            } else if constexpr (std::is_same_v<K, std::string>) {
-                table.insert(to_string(i), i);
-                keys.push_back(to_string(i));
-            } else if constexpr (std::is_same_v<V, std::string>) {
-                table.insert(i, to_string(i));
-                keys.push_back(i);
-            } else {
-                table.insert(i, i);
-                keys.push_back(i);
-            }
-        } else {
-            if constexpr (std::is_same_v<K, std::string> && std::is_same_v<V, std::string>) {
-                table[to_string(i)] = to_string(i);
-                keys.push_back(to_string(i));
-            } else if constexpr (std::is_same_v<K, std::string>) {
-                table[to_string(i)] = i;
-                keys.push_back(to_string(i));
-            } else if constexpr (std::is_same_v<V, std::string>) {
-                table[i] = to_string(i);
-                keys.push_back(i);
+    chronoTableFill(table, keys, values);
+    suite.run(chronoTableCase<K, V, Container>("get", "Get", keys.size()), keys.size(), [&table, &keys] {
+        for (const auto &key: keys) {
+            if constexpr (is_same_v<Container, HashTable<K, V>>) {
+                doNotOptimize(table.get(key));
             } else {
-                table[i] = i;
-                keys.push_back(i);
+                doNotOptimize(table.at(key));
             }
         }
-    }
-    auto start = chrono::high_resolution_clock::now();
-    if constexpr (is_same_v<Container, HashTable<K, V>>) {
-        for (const auto &key: keys) {
-            table.remove(key);
-        }
-    } else {
-        for (const auto &key: keys) {
-            table.erase(key);
-        }
-    }
-    auto end = chrono::high_resolution_clock::now();
-    auto duration = chrono::duration_cast<chrono::milliseconds>(end - start);
-    cout << "Removal time for " << elementCount << " elements " << demangle(typeid(Container).name()) << ": "
-         << duration.count() << " ms" << endl;
+    });
 }
 
+template<typename K, typename V, typename Container>
+void chronoRemovalTable(BenchmarkSuite &suite, const vector<K> &keys, const vector<V> &values) {
+    suite.run(chronoTableCase<K, V, Container>("remove", "Removal", keys.size()), keys.size(),
+              [&keys, &values] {
+                  Container table;
+                  chronoTableFill(table, keys, values);
+                  return table;
+              },
+              [&keys](Container &table) {
+                  for (const auto &key: keys) {
+                      if constexpr (is_same_v<Container, HashTable<K, V>>) {
+                          table.remove(key);
+                      } else {
+                          table.erase(key);
+                      }
+                  }
+                  doNotOptimize(table);
+              });
+}
 
-void chronoHashTable(size_t num_elements) {
-    cout << "Comparing HashTable and std::unordered_map for <int, int>:" << endl;
-    chronoInsertionTable<int, int, HashTable<int, int>>(num_elements);
-    chronoInsertionTable<int, int, std::unordered_map<int, int>>(num_elements);
-    chronoGetTable<int, int, HashTable<int, int>>(num_elements);
-    chronoGetTable<int, int, std::unordered_map<int, int>>(num_elements);
-    chronoRemovalTable<int, int, HashTable<int, int>>(num_elements);
-    chronoRemovalTable<int, int, std::unordered_map<int, int>>(num_elements);
-    cout << endl;
+template<typename K, typename V>
+void chronoTablePair(BenchmarkSuite &suite, const string &types, size_t elementCount) {
+    vector<K> keys = chronoTableKeys<K>(elementCount);
+    vector<V> values = chronoTableKeys<V>(elementCount);
 
-    cout << "Comparing HashTable and std::unordered_map for <int, string>:" << endl;
-    chronoInsertionTable<int, string, HashTable<int, string>>(num_elements);
-    chronoInsertionTable<int, string, std::unordered_map<int, string>>(num_elements);
-    chronoGetTable<int, string, HashTable<int, string>>(num_elements);
-    chronoGetTable<int, string, std::unordered_map<int, string>>(num_elements);
-    chronoRemovalTable<int, string, HashTable<int, string>>(num_elements);
-    chronoRemovalTable<int, string, std::unordered_map<int, string>>(num_elements);
-    cout << endl;
+    suite.section("Comparing HashTable and std::unordered_map for <" + types + ">, " + to_string(elementCount) +
+                  " elements");
+    chronoInsertionTable<K, V, HashTable<K, V>>(suite, keys, values);
+    chronoInsertionTable<K, V, unordered_map<K, V>>(suite, keys, values);
+    chronoGetTable<K, V, HashTable<K, V>>(suite, keys, values);
+    chronoGetTable<K, V, unordered_map<K, V>>(suite, keys, values);
+    chronoRemovalTable<K, V, HashTable<K, V>>(suite, keys, values);
+    chronoRemovalTable<K, V, unordered_map<K, V>>(suite, keys, values);
+}
 
-    cout << "Comparing HashTable and std::unordered_map for <string, int>:" << endl;
-    chronoInsertionTable<string, int, HashTable<string, int>>(num_elements);
-    chronoInsertionTable<string, int, std::unordered_map<string, int>>(num_elements);
-    chronoGetTable<string, int, HashTable<string, int>>(num_elements);
-    chronoGetTable<string, int, std::unordered_map<string, int>>(num_elements);
-    chronoRemovalTable<string, int, HashTable<string, int>>(num_elements);
-    chronoRemovalTable<string, int, std::unordered_map<string, int>>(num_elements);
-    cout << endl;
 
-    cout << "Comparing HashTable and std::unordered_map for <string, string>:" << endl;
-    chronoInsertionTable<string, string, HashTable<string, string>>(num_elements);
-    chronoInsertionTable<string, string, std::unordered_map<string, string>>(num_elements);
-    chronoGetTable<string, string, HashTable<string, string>>(num_elements);
-    chronoGetTable<string, string, std::unordered_map<string, string>>(num_elements);
-    chronoRemovalTable<string, string, HashTable<string, string>>(num_elements);
-    chronoRemovalTable<string, string, std::unordered_map<string, string>>(num_elements);
-    cout << endl;
+void chronoHashTable(size_t num_elements) {
+    BenchmarkSuite suite("Performance tests for HashTable vs std::unordered_map");
+    chronoTablePair<int, int>(suite, "int, int", num_elements);
+    chronoTablePair<int, string>(suite, "int, string", num_elements);
+    chronoTablePair<string, int>(suite, "string, int", num_elements);
+    chronoTablePair<string, string>(suite, "string, string", num_elements);
 }
\ No newline at end of file
@@ -3,10 +3,4 @@
 #include "../../include/hash_table.hpp"
 
 
-void chronoInsertionTable(size_t elementCount);
-
-void chronoGetTable(size_t elementCount);
-
-void chronoRemovalTable(size_t elementCount);
-
 void chronoHashTable(size_t num_elements);
\ No newline at end of file
@@ -0,0 +1,285 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "chrono_hash_workload.hpp"
+#include "benchmark.hpp"
+#include "demangle.hpp"
+#include "../../include/random.hpp"
+
+
+using namespace std;
+
+namespace {
+    enum class KeyDistribution {
+        Uniform,
+        Zipf,
+        Adversarial
+    };
+
+    const char *distributionName(KeyDistribution distribution) {
+        switch (distribution) {
+            case KeyDistribution::Uniform:
+                return "uniform";
+            case KeyDistribution::Zipf:
+                return "zipf";
+            default:
+                return "adversarial";
+        }
+    }
+
+    // В adversarial-сценарии каждая операция проходит всю цепочку, поэтому ключей не больше этого
+    constexpr size_t adversarial_keys = 16384;
+    constexpr double zipf_exponent = 0.99;
+    constexpr size_t string_key_length = 64;
+
+    struct WorkloadOp {
+        bool write;
+        size_t key;                 // индекс в pool: [0, keys) - есть в таблице, [keys, 2 * keys) - нет
+    };
+
+    template<typename K>
+    struct HashWorkload {
+        vector<K> pool;
+        size_t keys = 0;
+        vector<WorkloadOp> ops;
+    };
+
+    // Ранг k (0 - самый частый) с вероятностью ~ 1 / (k + 1)^s: бинарный поиск по накопленным весам
+    class ZipfSampler {
+    private:
+        vector<double> cdf;
+
+    public:
+        ZipfSampler(size_t n, double exponent) : cdf(n) {
+            double total = 0;
+            for (size_t k = 0; k < n; ++k) {
+                total += 1.0 / pow(static_cast<double>(k + 1), exponent);
+                cdf[k] = total;
+            }
+            for (double &value: cdf) {
+                value /= total;
+            }
+        }
+
+        size_t operator()(RandomEngine &rng) const {
+            auto it = lower_bound(cdf.begin(), cdf.end(), rng.uniformReal());
+            return min(static_cast<size_t>(it - cdf.begin()), cdf.size() - 1);
+        }
+    };
+
+    void shuffleIndices(vector<size_t> &indices, RandomEngine &rng) {
+        for (size_t i = indices.size(); i > 1; --i) {
+            swap(indices[i - 1], indices[rng.uniformIndex(i)]);
+        }
+    }
+
+    // 2 * keys различных ключей: первая половина вставляется в таблицу, вторая - промахи
+    vector<int> workloadIntPool(size_t keys, KeyDistribution distribution, RandomEngine &rng) {
+        vector<int> pool;
+        pool.reserve(2 * keys);
+        if (distribution == KeyDistribution::Adversarial) {
+            // Число бакетов HashTable после вставки keys элементов зависит только от их количества
+            HashTable<int, int> probe;
+            for (size_t i = 0; i < keys; ++i) {
+                probe.insert(static_cast<int>(i), 0);
+            }
+            auto buckets = static_cast<int>(probe.bucketCount());
+            for (size_t i = 0; i < 2 * keys; ++i) {
+                pool.push_back(static_cast<int>(i) * buckets);
+            }
+            return pool;
+        }
+        unordered_set<int> seen;
+        while (pool.size() < 2 * keys) {
+            int key = rng.uniformInt(0, INT32_MAX);
+            if (seen.insert(key).second) {
+                pool.push_back(key);
+            }
+        }
+        return pool;
+    }
+
+    vector<string> workloadStringPool(size_t keys, RandomEngine &rng) {
+        static const char alphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+        vector<string> pool;
+        pool.reserve(2 * keys);
+        unordered_set<string> seen;
+        while (pool.size() < 2 * keys) {
+            string key(string_key_length, ' ');
+            for (char &c: key) {
+                c = alphabet[rng.uniformIndex(sizeof(alphabet) - 1)];
+            }
+            if (seen.insert(key).second) {
+                pool.push_back(std::move(key));
+            }
+        }
+        return pool;
+    }
+
+    // Поток из keys операций. Ранги популярности перемешаны, чтобы частые ключи не совпадали с первыми вставленными
+    vector<WorkloadOp> workloadOps(size_t keys, KeyDistribution distribution, double hit_ratio, double write_ratio,
+                                   RandomEngine &rng) {
+        vector<size_t> present(keys);
+        vector<size_t> absent(keys);
+        for (size_t i = 0; i < keys; ++i) {
+            present[i] = i;
+            absent[i] = keys + i;
+        }
+        shuffleIndices(present, rng);
+        shuffleIndices(absent, rng);
+
+        ZipfSampler zipf(distribution == KeyDistribution::Zipf ? keys : 0, zipf_exponent);
+        vector<WorkloadOp> ops(keys);
+        for (WorkloadOp &op: ops) {
+            size_t rank = distribution == KeyDistribution::Zipf ? zipf(rng) : rng.uniformIndex(keys);
+            op.key = rng.uniformReal() < hit_ratio ? present[rank] : absent[rank];
+            op.write = rng.uniformReal() < write_ratio;
+        }
+        return ops;
+    }
+
+    template<typename K>
+    bool workloadRead(const HashTable<K, int> &table, const K &key) {
+        return table.contains(key);
+    }
+
+    template<typename K>
+    bool workloadRead(const unordered_map<K, int> &table, const K &key) {
+        return table.find(key) != table.end();
+    }
+
+    template<typename K>
+    bool workloadRead(const HashSet<K> &set, const K &key) {
+        return set.contains(key);
+    }
+
+    template<typename K>
+    bool workloadRead(const unordered_set<K> &set, const K &key) {
+        return set.find(key) != set.end();
+    }
+
+    template<typename K>
+    void workloadWrite(HashTable<K, int> &table, const K &key, int value) {
+        table.insert(key, value);
+    }
+
+    template<typename K>
+    void workloadWrite(unordered_map<K, int> &table, const K &key, int value) {
+        table.insert_or_assign(key, value);
+    }
+
+    template<typename K>
+    void workloadWrite(HashSet<K> &set, const K &key, int) {
+        set.add(key);
+    }
+
+    template<typename K>
+    void workloadWrite(unordered_set<K> &set, const K &key, int) {
+        set.insert(key);
+    }
+
+    // Число найденных ключей, чтобы чтения не выбросил оптимизатор
+    template<typename K, typename Container>
+    size_t workloadApply(Container &container, const HashWorkload<K> &workload, size_t begin, size_t end) {
+        size_t found = 0;
+        for (size_t i = begin; i < end; ++i) {
+            const WorkloadOp &op = workload.ops[i];
+            if (op.write) {
+                workloadWrite(container, workload.pool[op.key], static_cast<int>(i));
+            } else {
+                found += workloadRead(container, workload.pool[op.key]);
+            }
+        }
+        return found;
+    }
+
+    template<typename K, typename Container>
+    void chronoWorkloadCase(BenchmarkSuite &suite, const HashWorkload<K> &workload, const string &key_type,
+                            const string &operation, bool writes) {
+        Container filled;
+        for (size_t i = 0; i < workload.keys; ++i) {
+            workloadWrite(filled, workload.pool[i], static_cast<int>(i));
+        }
+        string container = demangle(typeid(Container).name());
+        BenchmarkCase info{container, operation, key_type, workload.keys, container};
+        size_t count = workload.ops.size();
+
+        if (writes) {
+            suite.run(info, count, [&filled] { return filled; }, [&workload, count](Container &copy) {
+                doNotOptimize(workloadApply(copy, workload, 0, count));
+                doNotOptimize(copy);
+            });
+        } else {
+            suite.run(info, count, [&filled, &workload, count] {
+                doNotOptimize(workloadApply(filled, workload, 0, count));
+            });
+        }
+
+        // Задержки отдельных операций - отдельным проходом по копии
+        Container copy = filled;
+        LatencyHistogram latencies = sampleLatencies(count, [&copy, &workload](size_t i) {
+            doNotOptimize(workloadApply(copy, workload, i, i + 1));
+        });
+        cout << "      latency: " << formatLatencyPercentiles(latencies) << endl;
+    }
+
+    struct WorkloadMix {
+        const char *name;
+        const char *title;
+        double write_ratio;
+    };
+
+    const WorkloadMix workload_mixes[] = {
+            {"read",      "reads only",              0.0},
+            {"r90/w10",   "90% reads / 10% writes",  0.1},
+            {"r50/w50",   "50% reads / 50% writes",  0.5},
+    };
+
+    // Для int сравниваются и множества: HashSet против std::unordered_set
+    template<typename K>
+    void chronoWorkloadDistribution(BenchmarkSuite &suite, size_t num_elements, KeyDistribution distribution,
+                                    double hit_ratio) {
+        RandomEngine rng(RngEngine::Xoshiro256, 42);
+        HashWorkload<K> workload;
+        workload.keys = distribution == KeyDistribution::Adversarial ? min(num_elements, adversarial_keys)
+                                                                     : num_elements;
+        workload.keys = max<size_t>(workload.keys, 1);
+        if constexpr (is_same_v<K, string>) {
+            workload.pool = workloadStringPool(workload.keys, rng);
+        } else {
+            workload.pool = workloadIntPool(workload.keys, distribution, rng);
+        }
+        string key_type = is_same_v<K, string> ? "string" + to_string(string_key_length) : "int";
+        auto hits = static_cast<int>(lround(hit_ratio * 100));
+
+        for (const WorkloadMix &mix: workload_mixes) {
+            workload.ops = workloadOps(workload.keys, distribution, hit_ratio, mix.write_ratio, rng);
+            string operation = string(distributionName(distribution)) + " " + mix.name + " hit" + to_string(hits);
+            suite.section("<" + key_type + "> " + distributionName(distribution) + " keys, " + mix.title + ", " +
+                          to_string(hits) + "% hits, " + to_string(workload.keys) + " keys");
+            chronoWorkloadCase<K, HashTable<K, int>>(suite, workload, key_type + ", int", operation,
+                                                     mix.write_ratio > 0);
+            chronoWorkloadCase<K, unordered_map<K, int>>(suite, workload, key_type + ", int", operation,
+                                                         mix.write_ratio > 0);
+            if constexpr (is_same_v<K, int>) {
+                chronoWorkloadCase<K, HashSet<K>>(suite, workload, key_type, operation, mix.write_ratio > 0);
+                chronoWorkloadCase<K, unordered_set<K>>(suite, workload, key_type, operation, mix.write_ratio > 0);
+            }
+        }
+    }
+}
+
+void chronoHashWorkload(size_t num_elements, double hit_ratio) {
+    hit_ratio = min(max(hit_ratio, 0.0), 1.0);
+    BenchmarkSuite suite("Key distributions and read/write mixes: HashTable vs std::unordered_map");
+    chronoWorkloadDistribution<int>(suite, num_elements, KeyDistribution::Uniform, hit_ratio);
+    chronoWorkloadDistribution<int>(suite, num_elements, KeyDistribution::Zipf, hit_ratio);
+    chronoWorkloadDistribution<int>(suite, num_elements, KeyDistribution::Adversarial, hit_ratio);
+    chronoWorkloadDistribution<string>(suite, num_elements, KeyDistribution::Uniform, hit_ratio);
+    chronoWorkloadDistribution<string>(suite, num_elements, KeyDistribution::Zipf, hit_ratio);
+}
\ No newline at end of file
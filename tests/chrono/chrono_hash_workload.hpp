@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+#include "../../include/hash_table.hpp"
+#include "../../include/hash_set.hpp"
+
+
+// Смешанные нагрузки на HashTable/HashSet против std::unordered_map/std::unordered_set.
+// Распределения ключей: uniform, zipf (s = 0.99) и adversarial - все ключи кратны числу бакетов HashTable
+// и попадают в одну цепочку (std::hash<int> - тождественная функция). Доля попаданий - hit_ratio, промахи
+// берутся из непересекающегося набора ключей. Смеси: только чтение, 90/10 и 50/50 чтение/запись
+// (запись - insert с заменой значения). Ключи - int и случайные строки из 64 символов.
+// Кроме медианы на операцию выводятся p50/p90/p99/p99.9/max задержки отдельных операций.
+void chronoHashWorkload(size_t num_elements, double hit_ratio = 0.9);
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include "chrono_latency.hpp"
+#include "benchmark.hpp"
+#include "../../include/array_sequence.hpp"
+#include "../../include/hash_table.hpp"
+
+
+using namespace std;
+
+namespace {
+    constexpr size_t latency_target_ops = 100000;
+    // remove(0) сдвигает весь массив, поэтому за проход удаляется не больше стольких элементов
+    constexpr size_t front_removals = 4096;
+
+    // setup() - свежий контейнер (вне замера), op(container, i) - i-я операция прохода
+    template<typename Setup, typename Op>
+    LatencyProfile chronoLatencyProfile(const string &group, const string &operation, size_t ops, Setup setup,
+                                        Op op) {
+        LatencyProfile profile{group, operation, LatencyHistogram()};
+        size_t rounds = max<size_t>(1, latency_target_ops / max<size_t>(ops, 1));
+        for (size_t round = 0; round < rounds; ++round) {
+            auto container = setup();
+            profile.histogram.merge(sampleLatencies(ops, [&container, &op](size_t i) { op(container, i); }));
+            doNotOptimize(container);
+        }
+        cout << "  " << operation << ": " << formatLatencyPercentiles(profile.histogram) << ", mean "
+             << formatDuration(profile.histogram.mean()) << " [" << profile.histogram.count() << " ops]" << endl;
+        return profile;
+    }
+
+    template<typename Table>
+    Table filledTable(int count) {
+        Table table;
+        for (int i = 0; i < count; ++i) {
+            if constexpr (is_same_v<Table, HashTable<int, int>>) {
+                table.insert(i, i);
+            } else {
+                table.insert({i, i});
+            }
+        }
+        return table;
+    }
+}
+
+vector<LatencyProfile> chronoLatency(size_t num_elements) {
+    int count = static_cast<int>(max<size_t>(num_elements, 1));
+    size_t removals = min<size_t>(count, front_removals);
+    vector<LatencyProfile> profiles;
+    cout << "Per-operation latency, " << count << " elements" << endl << endl;
+
+    cout << "Hash tables (HashTable rebuilds on growth and shrink):" << endl;
+    profiles.push_back(chronoLatencyProfile(
+            "hasht", "HashTable<int, int>::insert", count, [] { return HashTable<int, int>(); },
+            [](HashTable<int, int> &table, size_t i) { table.insert(static_cast<int>(i), 0); }));
+    profiles.push_back(chronoLatencyProfile(
+            "hasht", "std::unordered_map::insert", count, [] { return unordered_map<int, int>(); },
+            [](unordered_map<int, int> &table, size_t i) { table.insert({static_cast<int>(i), 0}); }));
+    profiles.push_back(chronoLatencyProfile(
+            "hasht", "HashTable<int, int>::remove", count, [count] { return filledTable<HashTable<int, int>>(count); },
+            [](HashTable<int, int> &table, size_t i) { table.remove(static_cast<int>(i)); }));
+    profiles.push_back(chronoLatencyProfile(
+            "hasht", "std::unordered_map::erase", count, [count] { return filledTable<unordered_map<int, int>>(count); },
+            [](unordered_map<int, int> &table, size_t i) { table.erase(static_cast<int>(i)); }));
+
+    cout << endl << "Arrays (ArraySequence reallocation on growth, shifts in remove):" << endl;
+    profiles.push_back(chronoLatencyProfile(
+            "arrseq", "ArraySequence<int>::add", count, [] { return ArraySequence<int>(); },
+            [](ArraySequence<int> &sequence, size_t i) { sequence.add(static_cast<int>(i)); }));
+    profiles.push_back(chronoLatencyProfile(
+            "arrseq", "std::vector::push_back", count, [] { return vector<int>(); },
+            [](vector<int> &sequence, size_t i) { sequence.push_back(static_cast<int>(i)); }));
+    profiles.push_back(chronoLatencyProfile(
+            "arrseq", "ArraySequence<int>::remove(0)", removals,
+            [count] {
+                ArraySequence<int> sequence(count);
+                for (int i = 0; i < count; ++i) {
+                    sequence.add(i);
+                }
+                return sequence;
+            },
+            [](ArraySequence<int> &sequence, size_t) { sequence.remove(0); }));
+    profiles.push_back(chronoLatencyProfile(
+            "arrseq", "std::vector::erase(begin)", removals,
+            [count] {
+                vector<int> sequence(count);
+                for (int i = 0; i < count; ++i) {
+                    sequence[i] = i;
+                }
+                return sequence;
+            },
+            [](vector<int> &sequence, size_t) { sequence.erase(sequence.begin()); }));
+    cout << endl;
+    return profiles;
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "../../include/latency_histogram.hpp"
+
+
+// Распределение задержек одной операции контейнера
+struct LatencyProfile {
+    std::string group;              // "hasht" - хеш-таблицы, "arrseq" - массивы
+    std::string operation;
+    LatencyHistogram histogram;
+};
+
+// Задержки отдельных операций там, где среднее скрывает выбросы: вставка и удаление в HashTable
+// (перестройка в checkAndResize), add и remove(0) в ArraySequence (перевыделение и сдвиг O(n)) против
+// std::unordered_map и std::vector. Контейнер на num_elements элементов; проходы повторяются на свежих
+// контейнерах, пока не наберётся ~100 тысяч операций. Выводит p50/p90/p99/p99.9/max и среднее
+std::vector<LatencyProfile> chronoLatency(size_t num_elements);
\ No newline at end of file
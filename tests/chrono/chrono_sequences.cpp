@@ -1,199 +1,316 @@
+#include <algorithm>
 #include <iostream>
 #include <chrono>
+#include <iterator>
+#include <string>
 #include <vector>
 #include <list>
 #include "chrono_sequences.hpp"
+#include "benchmark.hpp"
 #include "demangle.hpp"
 
-template<typename Container, typename T, typename Comparator>
-void chronoAddInt(size_t num_elements) {
-    Container cont;
-    Comparator comp;
+// Контейнеры std, с которыми сравниваются последовательности
+template<typename Container>
+inline constexpr bool is_std_container = std::is_same_v<Container, std::vector<int>> ||
+                                         std::is_same_v<Container, std::list<int>>;
 
-    auto start_cont = std::chrono::high_resolution_clock::now();
+template<typename Container>
+void chronoFill(Container &cont, size_t num_elements) {
     for (size_t i = 0; i < num_elements; ++i) {
-        cont.add(i);
+        if constexpr (is_std_container<Container>) {
+            cont.push_back(static_cast<int>(i));
+        } else {
+            cont.add(static_cast<int>(i));
+        }
     }
-    auto end_cont = std::chrono::high_resolution_clock::now();
-    auto duration_cont = std::chrono::duration_cast<std::chrono::microseconds>(end_cont - start_cont);
+}
 
-    auto start_comp = std::chrono::high_resolution_clock::now();
-    for (size_t i = 0; i < num_elements; ++i) {
-        comp.push_back(i);
-    }
-    auto end_comp = std::chrono::high_resolution_clock::now();
-    auto duration_comp = std::chrono::duration_cast<std::chrono::microseconds>(end_comp - start_comp);
+template<typename Container>
+Container chronoFilled(size_t num_elements) {
+    Container cont;
+    chronoFill(cont, num_elements);
+    return cont;
+}
 
-    std::cout << "Add " << num_elements << " elements:" << std::endl;
-    std::cout << "  " << demangle(typeid(Container).name()) << ": " << duration_cont.count() << " ms" << std::endl;
-    std::cout << "  " << demangle(typeid(Comparator).name()) << ": " << duration_comp.count() << " ms" << std::endl;
-    std::cout << std::endl;
+template<typename Container>
+std::string chronoName() {
+    return demangle(typeid(Container).name());
 }
 
-template<typename Container, typename T, typename Comparator>
-void chronoGetIndexInt(size_t num_elements, size_t step) {
-    Container cont;
-    Comparator comp;
-    for (size_t i = 0; i < num_elements; ++i) {
-        cont.add(i);
-        comp.push_back(i);
-    }
+template<typename Container>
+BenchmarkCase chronoCase(const std::string &operation, size_t num_elements) {
+    return {chronoName<Container>(), operation, "int", num_elements, chronoName<Container>()};
+}
 
-    auto start_cont = std::chrono::high_resolution_clock::now();
-    for (size_t i = 0; i < num_elements; i += num_elements / step) {
-        volatile T temp = cont.get(i);
-    }
-    auto end_cont = std::chrono::high_resolution_clock::now();
-    auto duration_cont = std::chrono::duration_cast<std::chrono::nanoseconds>(end_cont - start_cont);
-
-    auto start_comp = std::chrono::high_resolution_clock::now();
-    if constexpr (std::is_same_v<Comparator, std::list<T>>) {
-        for (size_t i = 0; i < num_elements; i += num_elements / step) {
-            auto it = comp.begin();
-            std::advance(it, i);
-            volatile T temp = *it;
+template<typename Container>
+void chronoAddInt(BenchmarkSuite &suite, size_t num_elements) {
+    suite.run(chronoCase<Container>("add", num_elements), num_elements, [] { return Container(); },
+              [num_elements](Container &cont) {
+                  chronoFill(cont, num_elements);
+                  doNotOptimize(cont);
+              });
+}
+
+template<typename Container>
+void chronoGetIndexInt(BenchmarkSuite &suite, size_t num_elements, size_t step) {
+    Container cont = chronoFilled<Container>(num_elements);
+    size_t stride = std::max<size_t>(num_elements / step, 1);
+    size_t accesses = (num_elements + stride - 1) / stride;
+    suite.run(chronoCase<Container>("get_index", num_elements), accesses, [&cont, num_elements, stride] {
+        for (size_t i = 0; i < num_elements; i += stride) {
+            if constexpr (std::is_same_v<Container, std::list<int>>) {
+                auto it = cont.begin();
+                std::advance(it, i);
+                doNotOptimize(*it);
+            } else if constexpr (is_std_container<Container>) {
+                doNotOptimize(cont[i]);
+            } else {
+                doNotOptimize(cont.get(i));
+            }
         }
-    } else {
-        for (size_t i = 0; i < num_elements; i += num_elements / step) {
-            volatile T temp = comp[i];
+    });
+}
+
+template<typename Container>
+void chronoIterateInt(BenchmarkSuite &suite, size_t num_elements) {
+    Container cont = chronoFilled<Container>(num_elements);
+    suite.run(chronoCase<Container>("iterate", num_elements), num_elements, [&cont] {
+        long long sum = 0;
+        for (int value: cont) {
+            sum += value;
         }
-    }
-    auto end_comp = std::chrono::high_resolution_clock::now();
-    auto duration_comp = std::chrono::duration_cast<std::chrono::nanoseconds>(end_comp - start_comp);
-
-    std::cout << "Get element by index (average over " << step << " accesses):" << std::endl;
-    std::cout << "  " << demangle(typeid(Container).name()) << ": " << duration_cont.count() / step << " ns"
-              << std::endl;
-    std::cout << "  " << demangle(typeid(Comparator).name()) << ": " << duration_comp.count() / step << " ns"
-              << std::endl;
-    std::cout << std::endl;
+        doNotOptimize(sum);
+    });
 }
 
-template<typename Container, typename T, typename Comparator>
-void chronoIterateInt(size_t num_elements) {
-    Container cont;
-    Comparator comp;
-    for (size_t i = 0; i < num_elements; ++i) {
-        cont.add(i);
-        comp.push_back(i);
+// Последовательный доступ get(0), get(1), ... (для списков - через кеш курсора);
+// у контейнеров std - обычный обход
+template<typename Container>
+void chronoSequentialGetInt(BenchmarkSuite &suite, size_t num_elements) {
+    if constexpr (is_std_container<Container>) {
+        Container cont = chronoFilled<Container>(num_elements);
+        BenchmarkCase info = chronoCase<Container>("sequential_get", num_elements);
+        info.label = info.container + " (iteration)";
+        suite.run(info, num_elements, [&cont] {
+            for (int value: cont) {
+                doNotOptimize(value);
+            }
+        });
+    } else {
+        Container cont = chronoFilled<Container>(num_elements);
+        suite.run(chronoCase<Container>("sequential_get", num_elements), num_elements, [&cont, num_elements] {
+            for (size_t i = 0; i < num_elements; ++i) {
+                doNotOptimize(cont.get(i));
+            }
+        });
     }
+}
 
-    auto start_cont = std::chrono::high_resolution_clock::now();
-    for (T val: cont) {
-        volatile T temp = val;
-    }
-    auto end_cont = std::chrono::high_resolution_clock::now();
-    auto duration_cont = std::chrono::duration_cast<std::chrono::microseconds>(end_cont - start_cont);
+// Удаление половины элементов с конца или из начала; заполнение не входит в замер
+template<typename Container>
+void chronoRemoveInt(BenchmarkSuite &suite, size_t num_elements, bool from_end) {
+    size_t num_removes = num_elements / 2;
+    suite.run(chronoCase<Container>(from_end ? "remove_end" : "remove_begin", num_elements), num_removes,
+              [num_elements] { return chronoFilled<Container>(num_elements); },
+              [num_removes, from_end](Container &cont) {
+                  for (size_t i = 0; i < num_removes; ++i) {
+                      if constexpr (is_std_container<Container>) {
+                          if (from_end) {
+                              cont.pop_back();
+                          } else {
+                              cont.erase(cont.begin());
+                          }
+                      } else {
+                          cont.remove(from_end ? cont.getSize() - 1 : 0);
+                      }
+                  }
+                  doNotOptimize(cont);
+              });
+}
+
+// Вставка в середину по индексу: для std::list - поиск позиции через std::advance
+template<typename Container>
+void chronoInsertMiddleInt(BenchmarkSuite &suite, size_t num_elements, size_t num_inserts) {
+    suite.run(chronoCase<Container>("insert_middle", num_elements), num_inserts,
+              [num_elements] { return chronoFilled<Container>(num_elements); },
+              [num_inserts](Container &cont) {
+                  for (size_t i = 0; i < num_inserts; ++i) {
+                      if constexpr (is_std_container<Container>) {
+                          auto it = cont.begin();
+                          std::advance(it, cont.size() / 2);
+                          cont.insert(it, static_cast<int>(i));
+                      } else {
+                          cont.insert(cont.getSize() / 2, static_cast<int>(i));
+                      }
+                  }
+                  doNotOptimize(cont);
+              });
+}
+
+// Общий набор сценариев: последовательность против контейнера std
+template<typename Container, typename Comparator>
+void chronoSequenceSuite(const std::string &title, size_t num_elements, size_t step, bool sequential_get) {
+    BenchmarkSuite suite("Performance tests for " + title);
+
+    suite.section("Add " + std::to_string(num_elements) + " elements");
+    chronoAddInt<Container>(suite, num_elements);
+    chronoAddInt<Comparator>(suite, num_elements);
 
-    auto start_comp = std::chrono::high_resolution_clock::now();
-    for (T val: comp) {
-        volatile T temp = val;
+    suite.section("Get element by index (" + std::to_string(std::min(step, num_elements)) + " accesses)");
+    chronoGetIndexInt<Container>(suite, num_elements, step);
+    chronoGetIndexInt<Comparator>(suite, num_elements, step);
+
+    suite.section("Iterate over " + std::to_string(num_elements) + " elements");
+    chronoIterateInt<Container>(suite, num_elements);
+    chronoIterateInt<Comparator>(suite, num_elements);
+
+    if (sequential_get) {
+        suite.section("Sequential get(i) over " + std::to_string(num_elements) + " elements");
+        chronoSequentialGetInt<Container>(suite, num_elements);
+        chronoSequentialGetInt<Comparator>(suite, num_elements);
     }
-    auto end_comp = std::chrono::high_resolution_clock::now();
-    auto duration_comp = std::chrono::duration_cast<std::chrono::microseconds>(end_comp - start_comp);
 
-    std::cout << "Iterate over " << num_elements << " elements:" << std::endl;
-    std::cout << "  " << demangle(typeid(Container).name()) << ": " << duration_cont.count() << " ms" << std::endl;
-    std::cout << "  " << demangle(typeid(Comparator).name()) << ": " << duration_comp.count() << " ms" << std::endl;
-    std::cout << std::endl;
+    suite.section("Remove " + std::to_string(num_elements / 2) + " elements from the end");
+    chronoRemoveInt<Container>(suite, num_elements, true);
+    chronoRemoveInt<Comparator>(suite, num_elements, true);
+
+    suite.section("Remove " + std::to_string(num_elements / 2) + " elements from the beginning");
+    chronoRemoveInt<Container>(suite, num_elements, false);
+    chronoRemoveInt<Comparator>(suite, num_elements, false);
 }
 
-template<typename Container, typename T, typename Comparator>
-void chronoRemoveInt(size_t num_elements) {
-    Container cont;
-    Comparator comp;
+// Развёрнутый список (блоки по 64 элемента) против ListSequence и std::list
+void chronoUnrolledList(size_t num_elements) {
+    size_t num_inserts = std::min<size_t>(num_elements, 20000);
+    BenchmarkSuite suite("UnrolledListSequence vs ListSequence vs std::list");
 
-    // Удаление с конца
-    for (size_t i = 0; i < num_elements; ++i) {
-        cont.add(i);
-        comp.push_back(i);
-    }
+    suite.section("Traverse " + std::to_string(num_elements) + " elements");
+    chronoIterateInt<UnrolledListSequence<int>>(suite, num_elements);
+    chronoIterateInt<ListSequence<int>>(suite, num_elements);
+    chronoIterateInt<std::list<int>>(suite, num_elements);
 
-    auto start_cont_end = std::chrono::high_resolution_clock::now();
-    for (size_t i = 0; i < num_elements / 2; ++i) {
-        cont.remove(cont.getSize() - 1);
-    }
-    auto end_cont_end = std::chrono::high_resolution_clock::now();
-    auto duration_cont_end = std::chrono::duration_cast<std::chrono::microseconds>(end_cont_end - start_cont_end);
+    suite.section("Insert " + std::to_string(num_inserts) + " elements in the middle");
+    chronoInsertMiddleInt<UnrolledListSequence<int>>(suite, num_elements, num_inserts);
+    chronoInsertMiddleInt<ListSequence<int>>(suite, num_elements, num_inserts);
+    chronoInsertMiddleInt<std::list<int>>(suite, num_elements, num_inserts);
+}
 
-    auto start_comp_end = std::chrono::high_resolution_clock::now();
-    if constexpr (std::is_same_v<Comparator, std::list<T>>) {
-        for (size_t i = 0; i < num_elements / 2; ++i) {
-            comp.pop_back();
-        }
-    } else {
-        for (size_t i = 0; i < num_elements / 2; ++i) {
-            comp.pop_back();
-        }
-    }
-    auto end_comp_end = std::chrono::high_resolution_clock::now();
-    auto duration_comp_end = std::chrono::duration_cast<std::chrono::microseconds>(end_comp_end - start_comp_end);
+void chronoSequence(size_t num_elements, size_t step) {
+    chronoSequenceSuite<Sequence<int>, std::vector<int>>("Sequence vs std::vector", num_elements, step, false);
+}
 
-    // Удаление из начала
-    Container cont2;
-    Comparator comp2;
-    for (size_t i = 0; i < num_elements; ++i) {
-        cont2.add(i);
-        comp2.push_back(i);
+void chronoListSequence(size_t num_elements, size_t step) {
+    chronoSequenceSuite<ListSequence<int>, std::list<int>>("ListSequence vs std::list", num_elements, step, true);
+    chronoUnrolledList(num_elements);
+}
+
+void chronoDoublyListSequence(size_t num_elements, size_t step) {
+    chronoSequenceSuite<DoublyListSequence<int>, std::list<int>>("DoublyListSequence vs std::list", num_elements, step,
+                                                                 true);
+}
+
+void chronoArraySequence(size_t num_elements, size_t step) {
+    chronoSequenceSuite<ArraySequence<int>, std::vector<int>>("ArraySequence vs std::vector", num_elements, step,
+                                                              false);
+}
+
+// Строковая нагрузка со счётчиком копирований
+struct CountedPayload {
+    std::string value;
+    static inline size_t copies = 0;
+
+    CountedPayload() = default;
+
+    explicit CountedPayload(std::string value) : value(std::move(value)) {}
+
+    CountedPayload(const CountedPayload &other) : value(other.value) {
+        ++copies;
     }
-    auto start_cont_begin = std::chrono::high_resolution_clock::now();
-    for (size_t i = 0; i < num_elements / 2; ++i) {
-        cont2.remove(0);
+
+    CountedPayload(CountedPayload &&other) noexcept = default;
+
+    CountedPayload &operator=(const CountedPayload &other) {
+        value = other.value;
+        ++copies;
+        return *this;
     }
-    auto end_cont_begin = std::chrono::high_resolution_clock::now();
-    auto duration_cont_begin = std::chrono::duration_cast<std::chrono::microseconds>(end_cont_begin - start_cont_begin);
 
-    auto start_comp_begin = std::chrono::high_resolution_clock::now();
-    if constexpr (std::is_same_v<Comparator, std::list<T>>) {
-        for (size_t i = 0; i < num_elements / 2; ++i) {
-            comp2.erase(comp2.begin());
+    CountedPayload &operator=(CountedPayload &&other) noexcept = default;
+};
+
+template<typename Container, typename Fill>
+void chronoCopyRun(const std::string &label, Fill fill) {
+    Container cont;
+    CountedPayload::copies = 0;
+    auto start = std::chrono::steady_clock::now();
+    fill(cont);
+    auto end = std::chrono::steady_clock::now();
+    double duration = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << "  " << label << ": " << formatDuration(duration) << ", copies: " << CountedPayload::copies << std::endl;
+}
+
+template<typename Container>
+void chronoCopiesContainer(const std::vector<std::string> &payloads) {
+    size_t num_elements = payloads.size();
+    size_t num_inserts = std::min<size_t>(num_elements, 20000);
+
+    std::cout << demangle(typeid(Container).name()) << ":" << std::endl;
+    chronoCopyRun<Container>("add(const T&)", [&](Container &cont) {
+        for (const auto &payload: payloads) {
+            CountedPayload element(payload);
+            cont.add(element);
         }
-    } else {
-        for (size_t i = 0; i < num_elements / 2; ++i) {
-            comp2.erase(comp2.begin());
+    });
+    chronoCopyRun<Container>("add(T&&)", [&](Container &cont) {
+        for (const auto &payload: payloads) {
+            CountedPayload element(payload);
+            cont.add(std::move(element));
         }
+    });
+    chronoCopyRun<Container>("emplace", [&](Container &cont) {
+        for (const auto &payload: payloads) {
+            cont.emplace(payload);
+        }
+    });
+    chronoCopyRun<Container>("insert(0, T&&) x" + std::to_string(num_inserts), [&](Container &cont) {
+        for (size_t i = 0; i < num_inserts; ++i) {
+            cont.insert(0, CountedPayload(payloads[i]));
+        }
+    });
+
+    std::vector<CountedPayload> source;
+    for (const auto &payload: payloads) {
+        source.emplace_back(payload);
     }
-    auto end_comp_begin = std::chrono::high_resolution_clock::now();
-    auto duration_comp_begin = std::chrono::duration_cast<std::chrono::microseconds>(end_comp_begin - start_comp_begin);
-
-    std::cout << "Remove " << num_elements / 2 << " elements:" << std::endl;
-    std::cout << "  From the end:" << std::endl;
-    std::cout << "    " << demangle(typeid(Container).name()) << ": " << duration_cont_end.count() << " ms"
-              << std::endl;
-    std::cout << "    " << demangle(typeid(Comparator).name()) << ": " << duration_comp_end.count() << " ms"
-              << std::endl;
-
-    std::cout << "  From the beginning:" << std::endl;
-    std::cout << "    " << demangle(typeid(Container).name()) << ": " << duration_cont_begin.count() << " ms"
-              << std::endl;
-    std::cout << "    " << demangle(typeid(Comparator).name()) << ": " << duration_comp_begin.count() << " ms"
-              << std::endl;
+    chronoCopyRun<Container>("append(move_iterator)", [&](Container &cont) {
+        cont.append(std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()));
+    });
     std::cout << std::endl;
 }
 
-void chronoSequence(size_t num_elements, size_t step) {
-    std::cout << "Performance tests for Sequence vs std::vector" << std::endl << std::endl;
-    chronoAddInt<Sequence<int>, int, std::vector<int>>(num_elements);
-    chronoGetIndexInt<Sequence<int>, int, std::vector<int>>(num_elements, step);
-    chronoIterateInt<Sequence<int>, int, std::vector<int>>(num_elements);
-    chronoRemoveInt<Sequence<int>, int, std::vector<int>>(num_elements);
-    std::cout << std::endl;
-}
+void chronoCopies(size_t num_elements) {
+    std::cout << "Copies of string payloads (" << num_elements << " elements)" << std::endl << std::endl;
+    std::vector<std::string> payloads;
+    payloads.reserve(num_elements);
+    for (size_t i = 0; i < num_elements; ++i) {
+        payloads.push_back("vertex-payload-" + std::to_string(i) + "-outside-small-string-buffer");
+    }
 
-void chronoListSequence(size_t num_elements, size_t step) {
-    std::cout << "Performance tests for ListSequence vs std::list" << std::endl << std::endl;
-    chronoAddInt<ListSequence<int>, int, std::list<int>>(num_elements);
-    chronoGetIndexInt<ListSequence<int>, int, std::list<int>>(num_elements, step);
-    chronoIterateInt<ListSequence<int>, int, std::list<int>>(num_elements);
-    chronoRemoveInt<ListSequence<int>, int, std::list<int>>(num_elements);
-    std::cout << std::endl;
-}
+    chronoCopiesContainer<Sequence<CountedPayload>>(payloads);
+    chronoCopiesContainer<ArraySequence<CountedPayload>>(payloads);
+    chronoCopiesContainer<ListSequence<CountedPayload>>(payloads);
 
-void chronoArraySequence(size_t num_elements, size_t step) {
-    std::cout << "Performance tests for ArraySequence vs std::vector" << std::endl << std::endl;
-    chronoAddInt<ArraySequence<int>, int, std::vector<int>>(num_elements);
-    chronoGetIndexInt<ArraySequence<int>, int, std::vector<int>>(num_elements, step);
-    chronoIterateInt<ArraySequence<int>, int, std::vector<int>>(num_elements);
-    chronoRemoveInt<ArraySequence<int>, int, std::vector<int>>(num_elements);
+    std::cout << "HashTable<int, CountedPayload> (insert with rebuilds):" << std::endl;
+    chronoCopyRun<HashTable<int, CountedPayload>>("insert(key, const V&)", [&](HashTable<int, CountedPayload> &table) {
+        for (size_t i = 0; i < num_elements; ++i) {
+            CountedPayload value(payloads[i]);
+            table.insert(static_cast<int>(i), value);
+        }
+    });
+    chronoCopyRun<HashTable<int, CountedPayload>>("insert(key, V&&)", [&](HashTable<int, CountedPayload> &table) {
+        for (size_t i = 0; i < num_elements; ++i) {
+            table.insert(static_cast<int>(i), CountedPayload(payloads[i]));
+        }
+    });
     std::cout << std::endl;
-}
\ No newline at end of file
+}
@@ -3,18 +3,19 @@
 #include "../../include/sequence.hpp"
 #include "../../include/array_sequence.hpp"
 #include "../../include/list_sequence.hpp"
+#include "../../include/doubly_list_sequence.hpp"
+#include "../../include/unrolled_list_sequence.hpp"
+#include "../../include/hash_table.hpp"
 
 
-void chronoAddInt(size_t num_elements);
+void chronoSequence(size_t num_elements, size_t step);
 
-void chronoGetIndexInt(size_t num_elements, size_t step);
+void chronoUnrolledList(size_t num_elements);
 
-void chronoIterateInt(size_t num_elements);
+void chronoListSequence(size_t num_elements, size_t step);
 
-void chronoRemoveInt(size_t num_elements);
+void chronoDoublyListSequence(size_t num_elements, size_t step);
 
-void chronoSequence(size_t num_elements, size_t step);
-
-void chronoListSequence(size_t num_elements, size_t step);
+void chronoArraySequence(size_t num_elements, size_t step);
 
-void chronoArraySequence(size_t num_elements, size_t step);
\ No newline at end of file
+void chronoCopies(size_t num_elements);
\ No newline at end of file
@@ -1,90 +1,88 @@
 #include <iostream>
-#include <chrono>
+#include <string>
 #include <vector>
 #include <set>
 #include "chrono_set.hpp"
+#include "benchmark.hpp"
 #include "demangle.hpp"
 
 
 using namespace std;
-using namespace chrono;
 
-template<typename T, typename Container>
-void chronoInsertSet(size_t elementCount) {
-    Container set;
-    auto start = high_resolution_clock::now();
+template<typename T>
+vector<T> chronoSetElements(size_t elementCount) {
+    vector<T> elements;
+    elements.reserve(elementCount);
     for (size_t i = 0; i < elementCount; ++i) {
-        if constexpr (is_same_v<Container, HashSet<T>>) {
-            if constexpr (is_same_v<T, std::string>) {
-                set.add(to_string(i));
-            } else {
-                set.add(i);
-            }
+        if constexpr (is_same_v<T, string>) {
+            elements.push_back(to_string(i));
         } else {
-            if constexpr (is_same_v<T, std::string>) {
-                set.insert(to_string(i));
-            } else {
-                set.insert(i);
-            }
+            elements.push_back(static_cast<T>(i));
         }
     }
-    auto end = high_resolution_clock::now();
-    auto duration = duration_cast<milliseconds>(end - start);
-    cout << "Insertion time for " << elementCount << " elements " << demangle(typeid(Container).name()) << ": "
-         << duration.count() << " ms" << endl;
+    return elements;
 }
 
 template<typename T, typename Container>
-void chronoRemoveSet(size_t elementCount) {
-    Container set;
-    std::vector<T> elements;
-    for (size_t i = 0; i < elementCount; ++i) {
+BenchmarkCase chronoSetCase(const string &operation, const string &title, size_t elementCount) {
+    string container = demangle(typeid(Container).name());
+    return {container, operation, is_same_v<T, string> ? "string" : demangle(typeid(T).name()), elementCount,
+            title + " " + container};
+}
+
+template<typename T, typename Container>
+void chronoSetFill(Container &set, const vector<T> &elements) {
+    for (const auto &element: elements) {
         if constexpr (is_same_v<Container, HashSet<T>>) {
-            if constexpr (is_same_v<T, std::string>) {
-                set.add(to_string(i));
-                elements.push_back(to_string(i));
-            } else {
-                set.add(i);
-                elements.push_back(i);
-            }
+            set.add(element);
         } else {
-            if constexpr (is_same_v<T, std::string>) {
-                set.insert(to_string(i));
-                elements.push_back(to_string(i));
-            } else {
-                set.insert(i);
-                elements.push_back(i);
-            }
-        }
-    }
-    auto start = high_resolution_clock::now();
-    if constexpr (is_same_v<Container, HashSet<T>>) {
-        for (const auto &element: elements) {
-            set.remove(element);
-        }
-    } else {
-        for (const auto &element: elements) {
-            set.erase(element);
+            set.insert(element);
         }
     }
-    auto end = high_resolution_clock::now();
-    auto duration = duration_cast<milliseconds>(end - start);
-    cout << "Removal time for " << elementCount << " elements " << demangle(typeid(Container).name()) << ": "
-         << duration.count() << " ms" << endl;
 }
 
-void chronoSet(size_t num_elements) {
-    cout << "Set tests for <int>:" << endl;
-    chronoInsertSet<int, HashSet<int>>(num_elements);
-    chronoInsertSet<int, std::set<int>>(num_elements);
-    chronoRemoveSet<int, HashSet<int>>(num_elements);
-    chronoRemoveSet<int, std::set<int>>(num_elements);
-    cout << endl;
+template<typename T, typename Container>
+void chronoInsertSet(BenchmarkSuite &suite, const vector<T> &elements) {
+    suite.run(chronoSetCase<T, Container>("insert", "Insertion", elements.size()), elements.size(),
+              [] { return Container(); },
+              [&elements](Container &set) {
+                  chronoSetFill(set, elements);
+                  doNotOptimize(set);
+              });
+}
 
-    cout << "Set tests for <string>:" << endl;
-    chronoInsertSet<string, HashSet<string>>(num_elements);
-    chronoInsertSet<string, std::set<string>>(num_elements);
-    chronoRemoveSet<string, HashSet<string>>(num_elements);
-    chronoRemoveSet<string, std::set<string>>(num_elements);
-    cout << endl;
+template<typename T, typename Container>
+void chronoRemoveSet(BenchmarkSuite &suite, const vector<T> &elements) {
+    suite.run(chronoSetCase<T, Container>("remove", "Removal", elements.size()), elements.size(),
+              [&elements] {
+                  Container set;
+                  chronoSetFill(set, elements);
+                  return set;
+              },
+              [&elements](Container &set) {
+                  for (const auto &element: elements) {
+                      if constexpr (is_same_v<Container, HashSet<T>>) {
+                          set.remove(element);
+                      } else {
+                          set.erase(element);
+                      }
+                  }
+                  doNotOptimize(set);
+              });
+}
+
+template<typename T>
+void chronoSetType(BenchmarkSuite &suite, const string &type, size_t elementCount) {
+    vector<T> elements = chronoSetElements<T>(elementCount);
+    suite.section("Set tests for <" + type + ">, " + to_string(elementCount) + " elements");
+    chronoInsertSet<T, HashSet<T>>(suite, elements);
+    chronoInsertSet<T, std::set<T>>(suite, elements);
+    chronoRemoveSet<T, HashSet<T>>(suite, elements);
+    chronoRemoveSet<T, std::set<T>>(suite, elements);
+}
+
+void chronoSet(size_t num_elements) {
+    BenchmarkSuite suite("Performance tests for HashSet vs std::set");
+    chronoSetType<int>(suite, "int", num_elements);
+    chronoSetType<string>(suite, "string", num_elements);
 }
\ No newline at end of file
@@ -3,9 +3,4 @@
 #include "../../include/hash_set.hpp"
 
 
-void chronoInsertSet(size_t elementCount);
-
-void chronoRemoveSet(size_t elementCount);
-
-void chronoSet(size_t num_elements);
-
+void chronoSet(size_t num_elements);
\ No newline at end of file
@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "chrono_sorts.hpp"
+#include "benchmark.hpp"
+
+
+std::vector<int> chronoSortInput(const std::string &pattern, size_t num_elements) {
+    std::mt19937 rng(42);
+    std::vector<int> values(num_elements);
+    for (size_t i = 0; i < num_elements; ++i) {
+        if (pattern == "random") {
+            values[i] = static_cast<int>(rng());
+        } else if (pattern == "sorted") {
+            values[i] = static_cast<int>(i);
+        } else if (pattern == "reversed") {
+            values[i] = static_cast<int>(num_elements - i);
+        } else {
+            values[i] = static_cast<int>(rng() % 16);
+        }
+    }
+    return values;
+}
+
+// Сортировка копии входных данных; копирование в ArraySequence в замер не входит.
+// Возвращает медиану в миллисекундах
+template<typename Sort, typename T>
+double chronoSortRun(BenchmarkSuite &suite, const BenchmarkCase &info, const std::vector<T> &values, Sort sort) {
+    const BenchmarkResult &result = suite.run(info, values.size(),
+                                              [&values] {
+                                                  ArraySequence<T> seq;
+                                                  seq.append(values.begin(), values.end());
+                                                  return seq;
+                                              },
+                                              [&sort](ArraySequence<T> &seq) {
+                                                  sort(seq);
+                                                  doNotOptimize(seq);
+                                              });
+    return result.median_ns / 1e6;
+}
+
+BenchmarkCase chronoSortCase(const std::string &algorithm, const std::string &input, const std::string &type,
+                             size_t num_elements) {
+    return {"ArraySequence<" + type + ">", algorithm + " " + input, type, num_elements, algorithm};
+}
+
+void chronoSortEdges(BenchmarkSuite &suite, size_t num_elements) {
+    std::mt19937 rng(42);
+    std::vector<Edge<int>> edges;
+    edges.reserve(num_elements);
+    for (size_t i = 0; i < num_elements; ++i) {
+        edges.emplace_back(static_cast<int>(i), static_cast<int>(rng() % num_elements), static_cast<int>(rng() % 100) + 1);
+    }
+    auto by_weight = [](const Edge<int> &a, const Edge<int> &b) { return a.weight < b.weight; };
+
+    suite.section("Sorting " + std::to_string(num_elements) + " Edge<int> by weight in [1, 100]");
+    chronoSortRun(suite, chronoSortCase("RadixSort", "weights", "Edge<int>", num_elements), edges,
+                  [](ArraySequence<Edge<int>> &seq) {
+                      RadixSort<Edge<int>>().sort(seq);
+                  });
+    chronoSortRun(suite, chronoSortCase("PdqSort", "weights", "Edge<int>", num_elements), edges,
+                  [by_weight](ArraySequence<Edge<int>> &seq) {
+                      PdqSort<Edge<int>>::sortRange(seq.contiguousData(), seq.contiguousData() + seq.getSize(),
+                                                    by_weight);
+                  });
+    chronoSortRun(suite, chronoSortCase("std::stable_sort", "weights", "Edge<int>", num_elements), edges,
+                  [by_weight](ArraySequence<Edge<int>> &seq) {
+                      std::stable_sort(seq.contiguousData(), seq.contiguousData() + seq.getSize(), by_weight);
+                  });
+}
+
+void chronoSorts(size_t num_elements) {
+    BenchmarkSuite suite("Performance tests for sorting " + std::to_string(num_elements) + " ints");
+    for (const std::string pattern: {"random", "sorted", "reversed", "duplicates"}) {
+        std::vector<int> values = chronoSortInput(pattern, num_elements);
+        suite.section("Input: " + pattern);
+
+        chronoSortRun(suite, chronoSortCase("PdqSort", pattern, "int", num_elements), values,
+                      [](ArraySequence<int> &seq) {
+                          PdqSort<int>().sort(seq, compareIntIncrease);
+                      });
+        chronoSortRun(suite, chronoSortCase("RadixSort", pattern, "int", num_elements), values,
+                      [](ArraySequence<int> &seq) {
+                          RadixSort<int>().sort(seq, ascending);
+                      });
+        chronoSortRun(suite, chronoSortCase("std::sort", pattern, "int", num_elements), values,
+                      [](ArraySequence<int> &seq) {
+                          std::sort(seq.contiguousData(), seq.contiguousData() + seq.getSize());
+                      });
+
+        // QuickSort квадратична на обратном порядке и повторах (и глубина рекурсии - O(n))
+        if (pattern == "random" || pattern == "sorted" || num_elements <= 20000) {
+            chronoSortRun(suite, chronoSortCase("QuickSort", pattern, "int", num_elements), values,
+                          [](ArraySequence<int> &seq) {
+                              QuickSort<int>().sort(seq, compareIntIncrease);
+                          });
+        } else {
+            std::cout << "  QuickSort: skipped (quadratic on this input)" << std::endl;
+        }
+    }
+    chronoSortEdges(suite, num_elements);
+}
+
+void chronoParallelSort(size_t num_elements) {
+    unsigned hardware = resolveThreadCount(0);
+    std::vector<unsigned> thread_counts = {1, 2, 4};
+    if (hardware > 4) {
+        thread_counts.push_back(hardware);
+    }
+    BenchmarkSuite suite("Performance tests for ParallelSort (" + std::to_string(hardware) + " hardware threads)");
+
+    std::vector<int> values = chronoSortInput("random", num_elements);
+    suite.section("Sorting " + std::to_string(num_elements) + " random ints");
+    chronoSortRun(suite, chronoSortCase("std::sort", "random", "int", num_elements), values,
+                  [](ArraySequence<int> &seq) {
+                      std::sort(seq.contiguousData(), seq.contiguousData() + seq.getSize());
+                  });
+    for (unsigned threads: thread_counts) {
+        std::string algorithm = "ParallelSort, " + std::to_string(threads) + " threads";
+        chronoSortRun(suite, chronoSortCase(algorithm, "random", "int", num_elements), values,
+                      [threads](ArraySequence<int> &seq) {
+                          ParallelSort<int>(threads).sort(seq, compareIntIncrease);
+                      });
+    }
+
+    std::mt19937 rng(42);
+    std::vector<Edge<std::string>> edges;
+    edges.reserve(num_elements);
+    for (size_t i = 0; i < num_elements; ++i) {
+        edges.emplace_back("v" + std::to_string(i), "v" + std::to_string(rng() % num_elements),
+                           static_cast<int>(rng() % 1000));
+    }
+    suite.section("Sorting " + std::to_string(num_elements) + " Edge<std::string> by weight (stable)");
+    auto by_weight = [](const Edge<std::string> &a, const Edge<std::string> &b) { return a.weight < b.weight; };
+    chronoSortRun(suite, chronoSortCase("std::stable_sort", "weights", "Edge<string>", num_elements), edges,
+                  [by_weight](ArraySequence<Edge<std::string>> &seq) {
+                      std::stable_sort(seq.contiguousData(), seq.contiguousData() + seq.getSize(), by_weight);
+                  });
+    for (unsigned threads: thread_counts) {
+        std::string algorithm = "ParallelSort, " + std::to_string(threads) + " threads";
+        chronoSortRun(suite, chronoSortCase(algorithm, "weights", "Edge<string>", num_elements), edges,
+                      [threads, by_weight](ArraySequence<Edge<std::string>> &seq) {
+                          ParallelSort<Edge<std::string>>(threads, 1 << 16, true)
+                                  .sortRange(seq.contiguousData(), seq.contiguousData() + seq.getSize(), by_weight);
+                      });
+    }
+}
+
+void chronoComparators(size_t num_elements) {
+    std::vector<int> values = chronoSortInput("random", num_elements);
+
+    // Число сравнений одинаково для обоих путей (тот же алгоритм), считаем его один раз
+    size_t comparisons = 0;
+    ArraySequence<int> counted;
+    counted.append(values.begin(), values.end());
+    PdqSort<int>().sort(counted, [&comparisons](int a, int b) {
+        ++comparisons;
+        return a < b;
+    });
+
+    BenchmarkSuite suite("Comparator call overhead");
+    suite.section("PdqSort on " + std::to_string(num_elements) + " random ints (" + std::to_string(comparisons) +
+                  " comparisons)");
+    double pointer = chronoSortRun(suite, chronoSortCase("ISorter + function pointer", "random", "int", num_elements),
+                                   values, [](ArraySequence<int> &seq) {
+                                       const ISorter<int> &sorter = PdqSort<int>();
+                                       sorter.sort(seq, compareIntIncrease);
+                                   });
+    double inlined = chronoSortRun(suite, chronoSortCase("PdqSort + Ascending tag", "random", "int", num_elements),
+                                   values, [](ArraySequence<int> &seq) {
+                                       PdqSort<int>().sort(seq, ascending);
+                                   });
+    chronoSortRun(suite, chronoSortCase("PdqSort + lambda", "random", "int", num_elements), values,
+                  [](ArraySequence<int> &seq) {
+                      PdqSort<int>().sort(seq, [](int a, int b) { return a < b; });
+                  });
+    if (comparisons) {
+        std::cout << "  Overhead per comparison: " << (pointer - inlined) * 1e6 / comparisons << " ns" << std::endl;
+    }
+
+    std::mt19937 rng(42);
+    std::vector<Edge<int>> edges;
+    edges.reserve(num_elements);
+    for (size_t i = 0; i < num_elements; ++i) {
+        edges.emplace_back(static_cast<int>(i), static_cast<int>(i + 1), static_cast<int>(rng()));
+    }
+    suite.section("Edge<int> by weight");
+    chronoSortRun(suite, chronoSortCase("ISorter + function pointer", "weights", "Edge<int>", num_elements), edges,
+                  [](ArraySequence<Edge<int>> &seq) {
+                      const ISorter<Edge<int>> &sorter = PdqSort<Edge<int>>();
+                      sorter.sort(seq, [](const Edge<int> &a, const Edge<int> &b) { return a.weight < b.weight; });
+                  });
+    chronoSortRun(suite, chronoSortCase("PdqSort + byKey(&Edge::weight)", "weights", "Edge<int>", num_elements),
+                  edges, [](ArraySequence<Edge<int>> &seq) {
+                      PdqSort<Edge<int>>().sort(seq, byKey(&Edge<int>::weight));
+                  });
+    chronoSortRun(suite, chronoSortCase("ArraySequence::sortBy (RadixSort)", "weights", "Edge<int>", num_elements),
+                  edges, [](ArraySequence<Edge<int>> &seq) {
+                      seq.sortBy(&Edge<int>::weight);
+                  });
+}
+
+void chronoSelection(size_t num_elements) {
+    std::vector<int> values = chronoSortInput("random", num_elements);
+    BenchmarkSuite suite("Selecting from " + std::to_string(num_elements) + " random ints");
+    chronoSortRun(suite, chronoSortCase("Full PdqSort", "random", "int", num_elements), values,
+                  [](ArraySequence<int> &seq) {
+                      PdqSort<int>().sort(seq, ascending);
+                  });
+    chronoSortRun(suite, chronoSortCase("nthElement (median)", "random", "int", num_elements), values,
+                  [](ArraySequence<int> &seq) {
+                      nthElement(seq, seq.getSize() / 2);
+                  });
+    // k = 10 и 1% от n: при n = 1000 это одно значение, при n < 100 второе было бы нулём
+    std::vector<size_t> selection_sizes;
+    for (size_t k: {size_t(10), num_elements / 100}) {
+        k = std::clamp<size_t>(k, 1, std::max<size_t>(num_elements, 1));
+        if (std::find(selection_sizes.begin(), selection_sizes.end(), k) == selection_sizes.end()) {
+            selection_sizes.push_back(k);
+        }
+    }
+    for (size_t k: selection_sizes) {
+        chronoSortRun(suite, chronoSortCase("partialSort, k = " + std::to_string(k), "random", "int", num_elements),
+                      values, [k](ArraySequence<int> &seq) {
+                          partialSort(seq, k);
+                      });
+        chronoSortRun(suite, chronoSortCase("topK, k = " + std::to_string(k), "random", "int", num_elements), values,
+                      [k](ArraySequence<int> &seq) {
+                          doNotOptimize(topK(seq, k).size());
+                      });
+    }
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "../../include/array_sequence.hpp"
+#include "../../include/graph.hpp"
+
+
+void chronoSorts(size_t num_elements);
+
+void chronoParallelSort(size_t num_elements);
+
+void chronoComparators(size_t num_elements);
+
+void chronoSelection(size_t num_elements);
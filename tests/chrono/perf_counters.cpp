@@ -0,0 +1,192 @@
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include "perf_counters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+namespace {
+    struct PerfEventInfo {
+        const char *name;
+        double PerfReading::*field;
+#if defined(__linux__)
+        uint32_t type;
+        uint64_t config;
+#endif
+    };
+
+#if defined(__linux__)
+    constexpr uint64_t cacheReadMiss(uint64_t cache) {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    }
+
+    const PerfEventInfo perf_events[] = {
+            {"cycles",        &PerfReading::cycles,        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {"instructions",  &PerfReading::instructions,  PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {"L1d misses",    &PerfReading::l1d_misses,    PERF_TYPE_HW_CACHE, cacheReadMiss(PERF_COUNT_HW_CACHE_L1D)},
+            {"LLC misses",    &PerfReading::llc_misses,    PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {"branch misses", &PerfReading::branch_misses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            {"dTLB misses",   &PerfReading::dtlb_misses,   PERF_TYPE_HW_CACHE, cacheReadMiss(PERF_COUNT_HW_CACHE_DTLB)},
+    };
+
+    int openEvent(const PerfEventInfo &event) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = event.type;
+        attr.config = event.config;
+        attr.disabled = 1;
+        attr.inherit = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#else
+    const PerfEventInfo perf_events[] = {
+            {"cycles",        &PerfReading::cycles},
+            {"instructions",  &PerfReading::instructions},
+            {"L1d misses",    &PerfReading::l1d_misses},
+            {"LLC misses",    &PerfReading::llc_misses},
+            {"branch misses", &PerfReading::branch_misses},
+            {"dTLB misses",   &PerfReading::dtlb_misses},
+    };
+#endif
+}
+
+PerfReading PerfReading::scaled(double divisor) const {
+    PerfReading result = *this;
+    for (const PerfEventInfo &event: perf_events) {
+        if (result.*event.field >= 0) {
+            result.*event.field /= divisor;
+        }
+    }
+    return result;
+}
+
+PerfCounters::PerfCounters() {
+    static_assert(sizeof(perf_events) / sizeof(perf_events[0]) == event_count, "perf_events size");
+#if defined(__linux__)
+    std::string missing;
+    int error = 0;
+    for (int i = 0; i < event_count; ++i) {
+        descriptors[i] = openEvent(perf_events[i]);
+        if (descriptors[i] < 0) {
+            error = errno;
+            missing += missing.empty() ? perf_events[i].name : std::string(", ") + perf_events[i].name;
+        }
+    }
+    if (!missing.empty()) {
+        unavailable = "perf_event_open failed for " + missing + " (" + std::strerror(error) + ")";
+        if (error == EACCES || error == EPERM) {
+            unavailable += ", see /proc/sys/kernel/perf_event_paranoid";
+        }
+    }
+#else
+    for (int &descriptor: descriptors) {
+        descriptor = -1;
+    }
+    unavailable = "hardware counters are only supported on Linux (perf_event_open)";
+#endif
+}
+
+PerfCounters::~PerfCounters() {
+#if defined(__linux__)
+    for (int descriptor: descriptors) {
+        if (descriptor >= 0) {
+            close(descriptor);
+        }
+    }
+#endif
+}
+
+bool PerfCounters::available() const {
+    for (int descriptor: descriptors) {
+        if (descriptor >= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PerfCounters::reset() {
+#if defined(__linux__)
+    for (int descriptor: descriptors) {
+        if (descriptor >= 0) {
+            ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+        }
+    }
+#endif
+}
+
+void PerfCounters::start() {
+#if defined(__linux__)
+    for (int descriptor: descriptors) {
+        if (descriptor >= 0) {
+            ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+void PerfCounters::stop() {
+#if defined(__linux__)
+    for (int descriptor: descriptors) {
+        if (descriptor >= 0) {
+            ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+#endif
+}
+
+PerfReading PerfCounters::read() const {
+    PerfReading reading;
+#if defined(__linux__)
+    for (int i = 0; i < event_count; ++i) {
+        uint64_t values[3];         // значение, time_enabled, time_running
+        if (descriptors[i] < 0 || ::read(descriptors[i], values, sizeof(values)) != sizeof(values)) {
+            continue;
+        }
+        double value = static_cast<double>(values[0]);
+        if (values[2] > 0 && values[2] < values[1]) {
+            value *= static_cast<double>(values[1]) / static_cast<double>(values[2]);
+        }
+        reading.*perf_events[i].field = values[1] > 0 && values[2] == 0 ? -1 : value;
+    }
+#endif
+    return reading;
+}
+
+std::string formatPerfReading(const PerfReading &per_op) {
+    std::string text;
+    char buffer[64];
+    if (per_op.cycles >= 0) {
+        std::snprintf(buffer, sizeof(buffer), "%.2f cycles/op", per_op.cycles);
+        text += buffer;
+    }
+    if (per_op.ipc() >= 0) {
+        std::snprintf(buffer, sizeof(buffer), "%sIPC %.2f", text.empty() ? "" : ", ", per_op.ipc());
+        text += buffer;
+    }
+    bool misses = false;
+    for (const PerfEventInfo &event: perf_events) {
+        double value = per_op.*event.field;
+        if (value < 0 || event.field == &PerfReading::cycles || event.field == &PerfReading::instructions) {
+            continue;
+        }
+        // "L1d misses" -> "L1d"
+        std::string name(event.name, std::strchr(event.name, ' ') - event.name);
+        std::snprintf(buffer, sizeof(buffer), "%s%s %.3f", misses ? ", " : text.empty() ? "misses/op: " : ", misses/op: ",
+                      name.c_str(), value);
+        text += buffer;
+        misses = true;
+    }
+    return text;
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+
+
+// Показания аппаратных счётчиков; -1 - счётчик недоступен
+struct PerfReading {
+    double cycles = -1;
+    double instructions = -1;
+    double l1d_misses = -1;         // промахи L1 данных на чтение
+    double llc_misses = -1;         // промахи последнего уровня кеша
+    double branch_misses = -1;
+    double dtlb_misses = -1;
+
+    [[nodiscard]] bool empty() const {
+        return cycles < 0 && instructions < 0 && l1d_misses < 0 && llc_misses < 0 && branch_misses < 0 &&
+               dtlb_misses < 0;
+    }
+
+    [[nodiscard]] double ipc() const {
+        return cycles > 0 && instructions >= 0 ? instructions / cycles : -1;
+    }
+
+    // Все доступные значения, делённые на divisor
+    [[nodiscard]] PerfReading scaled(double divisor) const;
+};
+
+
+// Счётчики Linux perf_event_open для текущего потока (и потоков, созданных после открытия), только user-space.
+// Каждое событие открывается отдельно: недоступные (нет прав - perf_event_paranoid, нет события в PMU,
+// виртуальная машина) пропускаются, остальные работают. При мультиплексировании значения масштабируются
+// по времени работы счётчика. На других системах счётчиков нет.
+class PerfCounters {
+private:
+    static constexpr int event_count = 6;
+
+    int descriptors[event_count];
+    std::string unavailable;        // причина, по которой не открылись все или часть событий
+
+public:
+    PerfCounters();
+
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters &) = delete;
+
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    // Открыт хотя бы один счётчик
+    [[nodiscard]] bool available() const;
+
+    // Пусто, если открылись все события
+    [[nodiscard]] const std::string &unavailableReason() const {
+        return unavailable;
+    }
+
+    void reset();
+
+    void start();
+
+    void stop();
+
+    // Накопленные с последнего reset() значения
+    [[nodiscard]] PerfReading read() const;
+};
+
+// "3.10 cycles/op, IPC 2.41, misses/op: L1d 0.125, LLC 0.002, branch 0.010, dTLB 0.000" по показаниям на одну операцию
+std::string formatPerfReading(const PerfReading &per_op);
\ No newline at end of file
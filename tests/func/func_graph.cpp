@@ -1,6 +1,7 @@
 #include <iostream>
 #include <cassert>
 #include "func_graph.hpp"
+#include "../../include/graph_generator.hpp"
 
 
 template <typename T>
@@ -143,6 +144,118 @@ void testGetEdgeCount() {
     assert(("GetEdgeCount_size_0", graph.getEdgeCount() == 3));
 }
 
+template <typename T>
+void testAddEdgesBulk() {
+    Graph<T> graph;
+    T v1, v2, v3;
+    getValues(v1, v2, v3);
+
+    graph.addVertex(v1);
+    graph.addVertex(v2);
+    graph.addVertex(v3);
+    graph.addEdge(v1, v2, 1);
+
+    std::vector<Edge<T>> batch = {Edge<T>(v2, v3, 2), Edge<T>(v2, v1, 5), Edge<T>(v3, v2, 7)};
+    graph.addEdges(batch);
+    assert(("AddEdgesBulk_edge_0", graph.hasEdge(v2, v3) && graph.hasEdge(v3, v2)));
+    assert(("AddEdgesBulk_size_0", graph.getEdges().getSize() == 2));
+    assert(("AddEdgesBulk_size_1", graph.getNeighbors(v2).getSize() == 2));
+    for (const auto& edge : graph.getEdges()) {
+        if (edge.vertex1 == v1) {
+            assert(("AddEdgesBulk_weight_0", edge.weight == 5));
+        } else {
+            assert(("AddEdgesBulk_weight_1", edge.weight == 7));
+        }
+    }
+
+    try {
+        graph.addEdges(std::vector<Edge<T>>{Edge<T>(v1, getValue<T>(10))});
+        assert(("AddEdgesBulk_missing_vertex", false));
+    } catch (const std::runtime_error &) {
+        assert(("AddEdgesBulk_OK", true));
+    }
+}
+
+template <typename T>
+bool sameEdges(const Graph<T>& g1, const Graph<T>& g2) {
+    ArraySequence<Edge<T>> edges1 = g1.getEdges();
+    ArraySequence<Edge<T>> edges2 = g2.getEdges();
+    if (edges1.getSize() != edges2.getSize()) {
+        return false;
+    }
+    for (size_t i = 0; i < edges1.getSize(); ++i) {
+        if (!(edges1.get(i) == edges2.get(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+void testGeneratorsDeterministic() {
+    GeneratorContext single(42, RngEngine::Xoshiro256, 1);
+    GeneratorContext multi(42, RngEngine::Xoshiro256, 4);
+    assert(("Deterministic_random", sameEdges(generateRandomGraph<T>(300, 0.05, 1, 9, single),
+                                              generateRandomGraph<T>(300, 0.05, 1, 9, multi))));
+    assert(("Deterministic_rmat", sameEdges(generateRMatGraph<T>(256, 2000, 1, 9, single),
+                                            generateRMatGraph<T>(256, 2000, 1, 9, multi))));
+    assert(("Deterministic_ba", sameEdges(generateBarabasiAlbertGraph<T>(500, 3, 1, 9, single),
+                                          generateBarabasiAlbertGraph<T>(500, 3, 1, 9, multi))));
+    assert(("Deterministic_grid", sameEdges(generateGridGraph<T>(20, 30, 1, 9, single),
+                                            generateGridGraph<T>(20, 30, 1, 9, multi))));
+    assert(("Deterministic_seed", !sameEdges(generateRandomGraph<T>(300, 0.05, 1, 9, GeneratorContext(42)),
+                                             generateRandomGraph<T>(300, 0.05, 1, 9, GeneratorContext(43)))));
+
+    for (RngEngine engine : {RngEngine::Mt19937, RngEngine::Xoshiro256}) {
+        GeneratorContext ctx(7, engine);
+        assert(("Deterministic_chain", sameEdges(generateChainGraph<T>(50, 1, 1000, ctx),
+                                                 generateChainGraph<T>(50, 1, 1000, ctx))));
+        assert(("Deterministic_cycle", sameEdges(generateCycleGraph<T>(50, 1, 1000, ctx),
+                                                 generateCycleGraph<T>(50, 1, 1000, ctx))));
+        assert(("Deterministic_complete", sameEdges(generateCompleteGraph<T>(20, 1, 1000, ctx),
+                                                    generateCompleteGraph<T>(20, 1, 1000, ctx))));
+    }
+    assert(("Deterministic_engine", !sameEdges(
+            generateChainGraph<T>(50, 1, 1000, GeneratorContext(7, RngEngine::Mt19937)),
+            generateChainGraph<T>(50, 1, 1000, GeneratorContext(7, RngEngine::Xoshiro256)))));
+}
+
+template <typename T>
+void testGeneratorsShape() {
+    Graph<T> chain = generateChainGraph<T>(10, 1, 1, GeneratorContext(7));
+    assert(("GeneratorsShape_chain_edges", chain.getEdgeCount() == 9));
+    Graph<T> cycle = generateCycleGraph<T>(10, 1, 1, GeneratorContext(7));
+    assert(("GeneratorsShape_cycle_edges", cycle.getEdgeCount() == 10));
+    Graph<T> complete = generateCompleteGraph<T>(10, 1, 1, GeneratorContext(7));
+    assert(("GeneratorsShape_complete_edges", complete.getEdgeCount() == 45));
+
+    Graph<T> grid = generateGridGraph<T>(4, 5, 1, 1, GeneratorContext(7));
+    assert(("GeneratorsShape_grid_vertices", grid.getVertexCount() == 20));
+    assert(("GeneratorsShape_grid_edges", grid.getEdgeCount() == 4 * 4 + 3 * 5));
+
+    Graph<T> full = generateRandomGraph<T>(30, 1.0, 1, 1, GeneratorContext(7));
+    assert(("GeneratorsShape_random_full", full.getEdgeCount() == 30 * 29 / 2));
+    Graph<T> empty = generateRandomGraph<T>(30, 0.0, 1, 1, GeneratorContext(7));
+    assert(("GeneratorsShape_random_empty", empty.getEdgeCount() == 0));
+
+    Graph<T> ba = generateBarabasiAlbertGraph<T>(200, 2, 3, 8, GeneratorContext(7));
+    assert(("GeneratorsShape_ba_vertices", ba.getVertexCount() == 200));
+    for (const auto& edge : ba.getEdges()) {
+        assert(("GeneratorsShape_ba_loop", edge.vertex1 != edge.vertex2));
+        assert(("GeneratorsShape_ba_weight", edge.weight >= 3 && edge.weight <= 8));
+    }
+
+    Graph<T> rmat = generateRMatGraph<T>(100, 500, 1, 1, GeneratorContext(7));
+    assert(("GeneratorsShape_rmat_edges", rmat.getEdges().getSize() <= 500 && rmat.getEdges().getSize() > 0));
+
+    try {
+        generateRMatGraph<T>(10, static_cast<size_t>(-1), 1, 1, GeneratorContext(7));
+        assert(("GeneratorsShape_rmat_overflow", false));
+    } catch (const std::invalid_argument &) {
+        assert(("GeneratorsShape_OK", true));
+    }
+}
+
 void testGraph() {
     testAddVertex<int>();
     testAddEdge<int>();
@@ -153,6 +266,9 @@ void testGraph() {
     testGetEdges<int>();
     testGetVertexCount<int>();
     testGetEdgeCount<int>();
+    testAddEdgesBulk<int>();
+    testGeneratorsDeterministic<int>();
+    testGeneratorsShape<int>();
 
     testAddVertex<std::string>();
     testAddEdge<std::string>();
@@ -163,6 +279,9 @@ void testGraph() {
     testGetEdges<std::string>();
     testGetVertexCount<std::string>();
     testGetEdgeCount<std::string>();
+    testAddEdgesBulk<std::string>();
+    testGeneratorsDeterministic<std::string>();
+    testGeneratorsShape<std::string>();
 
     std::cout << "All tests passed! (Graph)" << std::endl;
 }
\ No newline at end of file
@@ -27,4 +27,10 @@ void testGetVertexCount();
 
 void testGetEdgeCount();
 
+void testAddEdgesBulk();
+
+void testGeneratorsDeterministic();
+
+void testGeneratorsShape();
+
 void testGraph();
\ No newline at end of file
@@ -0,0 +1,272 @@
+#include <iostream>
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include "func_graph_io.hpp"
+#include "../../include/graph_generator.hpp"
+
+
+std::string tempGraphPath(const std::string &name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+template <typename T>
+bool sameGraph(const Graph<T>& g1, const Graph<T>& g2) {
+    if (g1.getVertexCount() != g2.getVertexCount() || g1.getEdges().getSize() != g2.getEdges().getSize()) {
+        return false;
+    }
+    for (const auto& edge : g1.getEdges()) {
+        if (!g2.hasEdge(edge.vertex1, edge.vertex2)) {
+            return false;
+        }
+        bool found = false;
+        for (const auto& other : g2.getEdges()) {
+            if (((other.vertex1 == edge.vertex1 && other.vertex2 == edge.vertex2) ||
+                 (other.vertex1 == edge.vertex2 && other.vertex2 == edge.vertex1)) && other.weight == edge.weight) {
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+void testBinaryRoundTrip() {
+    std::string path = tempGraphPath("lab4_roundtrip.l4g");
+    Graph<T> graph = generateRandomGraph<T>(60, 0.1, -5, 50, GeneratorContext(3));
+    graph.addVertex(vertexFromString<T>("1000"));
+    graph.addEdge(vertexFromString<T>("1000"), vertexFromString<T>("1000"), 4);
+
+    saveGraphBinary(graph, path);
+    MappedGraph mapped(path);
+    assert(("BinaryRoundTrip_vertices", mapped.getVertexCount() == graph.getVertexCount()));
+    assert(("BinaryRoundTrip_edges", mapped.getEdgeCount() == graph.getEdges().getSize()));
+    assert(("BinaryRoundTrip_graph", sameGraph(graph, mapped.toGraph<T>())));
+    std::filesystem::remove(path);
+}
+
+void testBinaryCsrView() {
+    std::string path = tempGraphPath("lab4_csr.l4g");
+    Graph<std::string> graph;
+    graph.addVertex("a");
+    graph.addVertex("bb");
+    graph.addVertex("ccc");
+    graph.addEdge("a", "bb", 7);
+    graph.addEdge("bb", "ccc", -2);
+    saveGraphBinary(graph, path);
+
+    MappedGraph mapped(path);
+    assert(("BinaryCsrView_kind", mapped.getVertexKind() == VertexKind::String));
+    size_t degree_sum = 0;
+    for (size_t v = 0; v < mapped.getVertexCount(); ++v) {
+        std::string name(mapped.vertexName(v));
+        assert(("BinaryCsrView_name", graph.hasVertex(name)));
+        assert(("BinaryCsrView_degree", mapped.neighbors(v).size() == graph.getNeighbors(name).getSize()));
+        for (size_t i = 0; i < mapped.neighbors(v).size(); ++i) {
+            std::string neighbor(mapped.vertexName(mapped.neighbors(v)[i]));
+            int weight = mapped.weights(v)[i];
+            assert(("BinaryCsrView_edge", graph.hasEdge(name, neighbor)));
+            assert(("BinaryCsrView_weight", weight == (name == "ccc" || neighbor == "ccc" ? -2 : 7)));
+        }
+        degree_sum += mapped.neighbors(v).size();
+    }
+    assert(("BinaryCsrView_entries", degree_sum == 4));
+    std::filesystem::remove(path);
+}
+
+void testBinaryEmptyGraph() {
+    std::string path = tempGraphPath("lab4_empty.l4g");
+    saveGraphBinary(Graph<int>(), path);
+    MappedGraph mapped(path);
+    assert(("BinaryEmptyGraph_vertices", mapped.getVertexCount() == 0));
+    assert(("BinaryEmptyGraph_graph", mapped.toGraph<int>().getVertexCount() == 0));
+    std::filesystem::remove(path);
+}
+
+void testBinaryCorruptedFile() {
+    std::string path = tempGraphPath("lab4_corrupted.l4g");
+    saveGraphBinary(generateChainGraph<int>(10, 1, 5, GeneratorContext(1)), path);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+    try {
+        MappedGraph mapped(path);
+        assert(("BinaryCorruptedFile_truncated", false));
+    } catch (const std::runtime_error &) {
+        assert(("BinaryCorruptedFile_OK", true));
+    }
+    std::filesystem::remove(path);
+
+    // Размер файла верный, но испорчены смещения или индексы соседей: открытие их не читает,
+    // ошибку находит validate() (его же вызывает toGraph)
+    auto patched = [&path](auto section_pos, uint64_t item, auto value) {
+        saveGraphBinary(generateChainGraph<int>(10, 1, 5, GeneratorContext(1)), path);
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        GraphFileHeader header{};
+        file.read(reinterpret_cast<char *>(&header), sizeof(header));
+        file.seekp(static_cast<std::streamoff>(header.*section_pos + item * sizeof(value)));
+        file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    };
+    patched(&GraphFileHeader::row_offsets_pos, 1, uint64_t(1) << 40);
+    try {
+        MappedGraph mapped(path);
+        mapped.validate();
+        assert(("BinaryCorruptedFile_row_offsets", false));
+    } catch (const std::runtime_error &) {
+        assert(("BinaryCorruptedFile_OK", true));
+    }
+    patched(&GraphFileHeader::name_offsets_pos, 2, uint64_t(0));
+    try {
+        MappedGraph mapped(path);
+        mapped.validate();
+        assert(("BinaryCorruptedFile_name_offsets", false));
+    } catch (const std::runtime_error &) {
+        assert(("BinaryCorruptedFile_OK", true));
+    }
+    patched(&GraphFileHeader::targets_pos, 0, uint32_t(10));
+    assert(("BinaryCorruptedFile_lazy_open", MappedGraph(path).getVertexCount() == 10));
+    try {
+        MappedGraph mapped(path);
+        mapped.toGraph<int>();
+        assert(("BinaryCorruptedFile_toGraph", false));
+    } catch (const std::runtime_error &) {
+        assert(("BinaryCorruptedFile_OK", true));
+    }
+    try {
+        MappedGraph mapped(path);
+        mapped.validate();
+        assert(("BinaryCorruptedFile_target", false));
+    } catch (const std::runtime_error &) {
+        assert(("BinaryCorruptedFile_OK", true));
+    }
+    std::filesystem::remove(path);
+
+    try {
+        MappedGraph mapped(tempGraphPath("lab4_missing.l4g"));
+        assert(("BinaryCorruptedFile_missing", false));
+    } catch (const std::runtime_error &) {
+        assert(("BinaryCorruptedFile_OK", true));
+    }
+}
+
+void writeText(const std::string &path, const std::string &text) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << text;
+}
+
+template <typename T>
+void testTextRoundTrip() {
+    Graph<T> graph = generateRandomGraph<T>(80, 0.08, -5, 50, GeneratorContext(9));
+    graph.addVertex(vertexFromString<T>("1000"));
+    graph.addEdge(vertexFromString<T>("1000"), vertexFromString<T>("1000"), 3);
+
+    for (const std::string name : {"lab4_roundtrip.txt", "lab4_roundtrip.gr", "lab4_roundtrip.mtx", "lab4_roundtrip.l4g"}) {
+        std::string path = tempGraphPath(name);
+        saveGraph(graph, path);
+        ImportStats stats;
+        Graph<T> loaded = loadGraph<T>(path, &stats);
+        assert(("TextRoundTrip_stats", stats.edges == graph.getEdges().getSize() && stats.bytes > 0));
+        if (graphFormatFromPath(path) == GraphFormat::EdgeList || graphFormatFromPath(path) == GraphFormat::Binary) {
+            assert(("TextRoundTrip_graph", sameGraph(graph, loaded)));
+        } else {
+            // DIMACS и Matrix Market нумеруют вершины заново, сравниваем число рёбер и сумму весов
+            long long weight_sum = 0;
+            for (const auto &edge : graph.getEdges()) weight_sum += edge.weight;
+            for (const auto &edge : loaded.getEdges()) weight_sum -= edge.weight;
+            assert(("TextRoundTrip_vertices", loaded.getVertexCount() >= graph.getVertexCount()));
+            assert(("TextRoundTrip_weights", weight_sum == 0));
+        }
+        std::filesystem::remove(path);
+    }
+}
+
+void testTextFormats() {
+    std::string path = tempGraphPath("lab4_edges.txt");
+    writeText(path, "# comment\na b 5\nb c\n\nd\r\nc a -2\n");
+    Graph<std::string> edges = loadGraph<std::string>(path);
+    assert(("TextFormats_edgelist_vertices", edges.getVertexCount() == 4));
+    assert(("TextFormats_edgelist_edges", edges.getEdges().getSize() == 3));
+    assert(("TextFormats_edgelist_weight", edges.getNeighbors("d").getSize() == 0 && edges.hasEdge("a", "c")));
+    std::filesystem::remove(path);
+
+    path = tempGraphPath("lab4_dimacs.gr");
+    writeText(path, "c sample\np sp 5 4\na 1 2 10\na 2 1 10\na 2 3 4\na 3 2 4\n");
+    Graph<int> dimacs = loadGraph<int>(path);
+    assert(("TextFormats_dimacs_vertices", dimacs.getVertexCount() == 5));
+    assert(("TextFormats_dimacs_edges", dimacs.getEdges().getSize() == 2));
+    assert(("TextFormats_dimacs_edge", dimacs.hasEdge(3, 2) && !dimacs.hasEdge(4, 5)));
+    std::filesystem::remove(path);
+
+    path = tempGraphPath("lab4_matrix.mtx");
+    writeText(path, "%%MatrixMarket matrix coordinate real symmetric\n% comment\n4 4 3\n2 1 1.6\n3 2 -2.2\n4 4 7\n");
+    Graph<int> matrix = loadGraph<int>(path);
+    assert(("TextFormats_mtx_vertices", matrix.getVertexCount() == 4));
+    assert(("TextFormats_mtx_edges", matrix.getEdges().getSize() == 3));
+    for (const auto &edge : matrix.getEdges()) {
+        if (edge.vertex1 + edge.vertex2 == 3) {
+            assert(("TextFormats_mtx_weight", edge.weight == 2));
+        } else if (edge.vertex1 + edge.vertex2 == 5) {
+            assert(("TextFormats_mtx_weight", edge.weight == -2));
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+void testTextMalformed() {
+    const std::pair<std::string, std::string> files[] = {
+            {"lab4_bad.txt", "1 2 3\n1 2 x\n"},
+            {"lab4_bad.gr", "p sp 2 1\nq 1 2 3\n"},
+            {"lab4_bad.mtx", "%%MatrixMarket matrix array real general\n2 2\n"},
+    };
+    for (const auto &file : files) {
+        std::string path = tempGraphPath(file.first);
+        writeText(path, file.second);
+        try {
+            loadGraph<int>(path);
+            assert(("TextMalformed_throw", false));
+        } catch (const std::runtime_error &) {
+            assert(("TextMalformed_OK", true));
+        }
+        std::filesystem::remove(path);
+    }
+
+    std::string path = tempGraphPath("lab4_names.txt");
+    writeText(path, "a b 1\n");
+    try {
+        loadGraph<int>(path);
+        assert(("TextMalformed_int_vertex", false));
+    } catch (const std::runtime_error &) {
+        assert(("TextMalformed_OK", true));
+    }
+    std::filesystem::remove(path);
+}
+
+void testTextParallel() {
+    std::string path = tempGraphPath("lab4_parallel.txt");
+    saveGraph(generateRMatGraph<int>(1 << 14, 200000, 1, 100, GeneratorContext(5)), path);
+    Graph<int> single = loadGraph<int>(path, nullptr, 1);
+    Graph<int> parallel = loadGraph<int>(path, nullptr, 4);
+    assert(("TextParallel_vertices", single.getVertexCount() == parallel.getVertexCount()));
+    assert(("TextParallel_edges", single.getEdges().getSize() == parallel.getEdges().getSize()));
+    for (const auto &edge : single.getEdges()) {
+        assert(("TextParallel_edge", parallel.hasEdge(edge.vertex1, edge.vertex2)));
+    }
+    std::filesystem::remove(path);
+}
+
+void testGraphIO() {
+    testBinaryRoundTrip<int>();
+    testBinaryRoundTrip<std::string>();
+    testBinaryCsrView();
+    testBinaryEmptyGraph();
+    testBinaryCorruptedFile();
+    testTextRoundTrip<int>();
+    testTextRoundTrip<std::string>();
+    testTextFormats();
+    testTextMalformed();
+    testTextParallel();
+
+    std::cout << "All tests passed! (Graph IO)" << std::endl;
+}
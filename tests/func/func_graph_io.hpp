@@ -0,0 +1,22 @@
+#pragma once
+
+#include "../../include/graph_text_io.hpp"
+
+
+void testBinaryRoundTrip();
+
+void testBinaryCsrView();
+
+void testBinaryEmptyGraph();
+
+void testBinaryCorruptedFile();
+
+void testTextRoundTrip();
+
+void testTextFormats();
+
+void testTextMalformed();
+
+void testTextParallel();
+
+void testGraphIO();
@@ -0,0 +1,84 @@
+#include <iostream>
+#include <cassert>
+#include "func_latency.hpp"
+
+
+void testRecordL() {
+    LatencyHistogram histogram;
+    assert(("Record_empty_0", histogram.count() == 0));
+    assert(("Record_empty_1", histogram.percentile(50) == 0));
+
+    histogram.record(5);
+    histogram.record(100);
+    histogram.record(1000000);
+    assert(("Record_count", histogram.count() == 3));
+    assert(("Record_min", histogram.min() == 5));
+    assert(("Record_max", histogram.max() == 1000000));
+    assert(("Record_mean", histogram.mean() > 333368 && histogram.mean() < 333369));
+
+    histogram.reset();
+    assert(("Record_reset", histogram.count() == 0 && histogram.max() == 0));
+}
+
+void testPercentileL() {
+    LatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 100; ++value) {
+        histogram.record(value);
+    }
+    // До 128 значения хранятся точно
+    assert(("Percentile_exact_0", histogram.percentile(50) == 50));
+    assert(("Percentile_exact_1", histogram.percentile(99) == 99));
+    assert(("Percentile_exact_2", histogram.percentile(100) == 100));
+    assert(("Percentile_exact_3", histogram.percentile(0) == 1));
+
+    // Дальше - с относительной погрешностью не больше 1/64
+    LatencyHistogram wide;
+    for (uint64_t value = 1000; value <= 1000000; value += 1000) {
+        wide.record(value);
+    }
+    uint64_t p90 = wide.percentile(90);
+    assert(("Percentile_wide_0", p90 >= 900000 && p90 <= 900000 + 900000 / 64));
+    assert(("Percentile_wide_1", wide.percentile(100) == 1000000));
+}
+
+void testMergeL() {
+    LatencyHistogram first;
+    LatencyHistogram second;
+    first.record(10);
+    first.record(20);
+    second.record(30000);
+    first.merge(second);
+    assert(("Merge_count", first.count() == 3));
+    assert(("Merge_min", first.min() == 10));
+    assert(("Merge_max", first.max() == 30000));
+    assert(("Merge_p50", first.percentile(50) == 20));
+
+    LatencyHistogram empty;
+    first.merge(empty);
+    assert(("Merge_empty", first.count() == 3 && first.min() == 10));
+}
+
+void testPercentileCurveL() {
+    LatencyHistogram histogram;
+    assert(("PercentileCurve_empty", histogram.percentileCurve().empty()));
+
+    for (uint64_t value = 1; value <= 1000; ++value) {
+        histogram.record(value);
+    }
+    auto curve = histogram.percentileCurve(1);
+    // p0, p90, p99, p99.9 и максимум
+    assert(("PercentileCurve_size", curve.size() == 5));
+    assert(("PercentileCurve_last", curve.back().first == 100 && curve.back().second == 1000));
+    for (size_t i = 1; i < curve.size(); ++i) {
+        assert(("PercentileCurve_monotonic", curve[i].second >= curve[i - 1].second));
+    }
+}
+
+void testLatencyHistogram() {
+    testRecordL();
+    testPercentileL();
+    testMergeL();
+    testPercentileCurveL();
+
+    std::cout << "All tests passed! (LatencyHistogram)" << std::endl;
+}
\ No newline at end of file
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "../../include/latency_histogram.hpp"
+
+
+void testRecordL();
+
+void testPercentileL();
+
+void testMergeL();
+
+void testPercentileCurveL();
+
+void testLatencyHistogram();
\ No newline at end of file
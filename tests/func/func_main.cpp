@@ -0,0 +1,58 @@
+#include <iostream>
+#include <string>
+#include "func_sequences.hpp"
+#include "func_hash_table.hpp"
+#include "func_set.hpp"
+#include "func_graph.hpp"
+#include "func_graph_io.hpp"
+#include "func_sorts.hpp"
+#include "func_latency.hpp"
+
+
+// Функциональные тесты без графического интерфейса (цель lab4_tests, запускается через ctest).
+// Без аргументов выполняются все группы, иначе - перечисленные (имена как у команд админки без префикса "f")
+
+namespace {
+    struct FuncTestEntry {
+        const char *name;
+        void (*run)();
+    };
+
+    const FuncTestEntry func_tests[] = {
+            {"seq",        testSequence},
+            {"listseq",    testListSequence},
+            {"dlistseq",   testDoublyListSequence},
+            {"unrlistseq", testUnrolledListSequence},
+            {"arrseq",     testArraySequence},
+            {"hasht",      testHashTable},
+            {"hset",       testSet},
+            {"graph",      testGraph},
+            {"graphio",    testGraphIO},
+            {"sort",       testSorts},
+            {"latency",    testLatencyHistogram},
+    };
+}
+
+int main(int argc, char *argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        bool known = false;
+        for (const FuncTestEntry &test: func_tests) {
+            known = known || argv[i] == std::string(test.name);
+        }
+        if (!known) {
+            std::cerr << "Error: Unknown test group '" << argv[i] << "'" << std::endl;
+            return 2;
+        }
+    }
+
+    for (const FuncTestEntry &test: func_tests) {
+        bool requested = argc == 1;
+        for (int i = 1; i < argc; ++i) {
+            requested = requested || argv[i] == std::string(test.name);
+        }
+        if (requested) {
+            test.run();
+        }
+    }
+    return 0;
+}
\ No newline at end of file
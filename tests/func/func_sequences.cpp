@@ -1,5 +1,12 @@
+#include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
 #include "func_sequences.hpp"
 
 
@@ -140,6 +147,326 @@ void testResize() {
     }
 }
 
+// Строка со счётчиком копирований
+struct CopyCounted {
+    std::string value;
+    static inline size_t copies = 0;
+
+    CopyCounted() = default;
+
+    explicit CopyCounted(std::string value) : value(std::move(value)) {}
+
+    CopyCounted(const std::string &value, size_t repeat) : value() {
+        for (size_t i = 0; i < repeat; ++i) {
+            this->value += value;
+        }
+    }
+
+    CopyCounted(const CopyCounted &other) : value(other.value) {
+        ++copies;
+    }
+
+    CopyCounted(CopyCounted &&other) noexcept = default;
+
+    CopyCounted &operator=(const CopyCounted &other) {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+
+    CopyCounted &operator=(CopyCounted &&other) noexcept = default;
+
+    bool operator==(const CopyCounted &other) const {
+        return value == other.value;
+    }
+
+    bool operator!=(const CopyCounted &other) const {
+        return value != other.value;
+    }
+};
+
+template<typename Container>
+void testMoveSemantics() {
+    CopyCounted::copies = 0;
+    Container seq;
+    for (int i = 0; i < 20; ++i) {
+        CopyCounted element(std::to_string(i));
+        seq.add(std::move(element));
+    }
+    seq.emplace("ab", 2);
+    seq.insert(0, CopyCounted("first"));
+    seq.insert(seq.getSize(), CopyCounted("last"));
+    seq.insert(5, CopyCounted("middle"));
+    assert(("MoveSemantics_no_copies", CopyCounted::copies == 0));
+    assert(("MoveSemantics_size", seq.getSize() == 24));
+    assert(("MoveSemantics_order", seq.get(0).value == "first" && seq.get(1).value == "0" &&
+                                   seq.get(5).value == "middle" && seq.get(6).value == "4" &&
+                                   seq.get(22).value == "abab" && seq.get(23).value == "last"));
+
+    std::vector<CopyCounted> source;
+    for (int i = 0; i < 5; ++i) {
+        source.emplace_back(std::to_string(100 + i));
+    }
+    seq.append(std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()));
+    assert(("MoveSemantics_append_moved", CopyCounted::copies == 0 && seq.getSize() == 29));
+    assert(("MoveSemantics_append_order", seq.get(24).value == "100" && seq.get(28).value == "104"));
+
+    seq.append(source.begin(), source.begin() + 2);
+    assert(("MoveSemantics_append_copied", CopyCounted::copies == 2 && seq.getSize() == 31));
+
+    bool thrown = false;
+    try {
+        seq.insert(seq.getSize() + 1, CopyCounted("out"));
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(("MoveSemantics_insert_range", thrown));
+}
+
+template<typename Container>
+void testRandomAccessIterator() {
+    using It = decltype(std::declval<Container &>().begin());
+    static_assert(std::is_same_v<typename std::iterator_traits<It>::iterator_category,
+            std::random_access_iterator_tag>, "random access iterator");
+
+    Container seq;
+    for (int i = 0; i < 10; ++i) {
+        seq.add((i * 7) % 10);
+    }
+    std::sort(seq.begin(), seq.end());
+    for (int i = 0; i < 10; ++i) {
+        assert(("RandomAccessIterator_sort", seq.get(i) == i));
+    }
+
+    const Container &cseq = seq;
+    assert(("RandomAccessIterator_lower_bound", *std::lower_bound(cseq.begin(), cseq.end(), 4) == 4));
+    assert(("RandomAccessIterator_distance", cseq.end() - cseq.begin() == 10));
+
+    auto it = seq.begin();
+    it += 5;
+    assert(("RandomAccessIterator_plus", *it == 5 && it[2] == 7 && *(it - 3) == 2 && *(2 + it) == 7));
+    --it;
+    assert(("RandomAccessIterator_decrement", *it-- == 4 && *it == 3));
+    assert(("RandomAccessIterator_compare", seq.begin() < it && it <= seq.end() && seq.end() > it));
+    ConstIterator<int> cit = it;
+    assert(("RandomAccessIterator_const", cit == it && seq.cend() - it == 7));
+
+    std::reverse(seq.begin(), seq.end());
+    assert(("RandomAccessIterator_reverse", seq.get(0) == 9 && seq.get(9) == 0));
+    assert(("RandomAccessIterator_accumulate", std::accumulate(seq.cbegin(), seq.cend(), 0) == 45));
+}
+
+template<typename Container>
+void testFastAccess() {
+    Container seq;
+    for (int i = 0; i < 10; ++i) {
+        seq.add(i * 2);
+    }
+    assert(("FastAccess_data", seq.data()[3] == 6 && seq.data() == &seq.get(0)));
+    seq.uncheckedAt(4) = 100;
+    assert(("FastAccess_uncheckedAt", seq.get(4) == 100 && seq.uncheckedAt(4) == 100));
+
+    Span<int> span = seq.span();
+    assert(("FastAccess_span", span.size() == 10 && span[9] == 18));
+    span[0] = -1;
+    assert(("FastAccess_span_write", seq.get(0) == -1));
+
+    const Container &cseq = seq;
+    Span<const int> view = cseq.view();
+    int sum = 0;
+    for (int value : view) {
+        sum += value;
+    }
+    assert(("FastAccess_view", sum == -1 + 100 + 90 - 8));
+    Span<const int> part = view.subspan(2, 3);
+    assert(("FastAccess_subspan", part.size() == 3 && part[0] == 4 && part[2] == 100));
+
+    if constexpr (checked_access) {
+        bool thrown = false;
+        try {
+            seq.uncheckedAt(10);
+        } catch (const std::out_of_range &) {
+            thrown = true;
+        }
+        assert(("FastAccess_checked", thrown));
+    }
+}
+
+template<typename Container>
+void testSequenceRef() {
+    static_assert(!std::is_polymorphic_v<Container>, "sequence without vtable");
+
+    Container seq;
+    SequenceRef<int> ref = seq;
+    ref.add(3);
+    ref.add(1);
+    ref.add(2);
+    assert(("SequenceRef_add", seq.getSize() == 3 && ref.getSize() == 3));
+    ref.get(0) = 5;
+    assert(("SequenceRef_get", seq.get(0) == 5));
+    ref.remove(1);
+    assert(("SequenceRef_remove", seq.getSize() == 2 && seq.get(1) == 2));
+    assert(("SequenceRef_contiguous", (ref.contiguousData() != nullptr) == (seq.contiguousData() != nullptr)));
+}
+
+// const get() не сдвигает кеш позиции, поэтому константный список можно читать из нескольких потоков
+// (гонку на кеше ловит сборка с -fsanitize=thread)
+template<typename Container>
+void testConcurrentConstGet() {
+    const int count = 2000;
+    Container seq;
+    for (int i = 0; i < count; ++i) {
+        seq.add(i);
+    }
+    seq.get(count / 2);
+
+    const Container &cseq = seq;
+    bool correct[4] = {};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&cseq, &correct, t, count] {
+            bool ok = true;
+            for (int i = 0; i < count; ++i) {
+                int index = t % 2 == 0 ? i : count - 1 - i;
+                ok = ok && cseq.get(index) == index;
+            }
+            correct[t] = ok;
+        });
+    }
+    for (std::thread &reader : readers) {
+        reader.join();
+    }
+    assert(("ConcurrentConstGet_values", std::all_of(std::begin(correct), std::end(correct), [](bool ok) { return ok; })));
+    assert(("ConcurrentConstGet_cursor", seq.get(count / 2 + 1) == count / 2 + 1 && seq.get(3) == 3));
+}
+
+void testListIterator() {
+    using It = ListSequence<int>::ListIterator;
+    static_assert(std::is_same_v<typename std::iterator_traits<It>::iterator_category,
+            std::forward_iterator_tag>, "forward iterator");
+
+    ListSequence<int> seq;
+    for (int i = 0; i < 10; ++i) {
+        seq.add(i);
+    }
+    assert(("ListIterator_distance", std::distance(seq.begin(), seq.end()) == 10));
+    assert(("ListIterator_find", *std::find(seq.begin(), seq.end(), 6) == 6));
+    assert(("ListIterator_accumulate", std::accumulate(seq.cbegin(), seq.cend(), 0) == 45));
+}
+
+void testListPositionOperations() {
+    ListSequence<int> seq;
+    for (int i = 0; i < 5; ++i) {
+        seq.add(i);
+    }
+    seq.pushFront(-1);
+    assert(("ListPosition_pushFront", seq.getSize() == 6 && seq.get(0) == -1));
+    seq.popFront();
+    assert(("ListPosition_popFront", seq.getSize() == 5 && seq.get(0) == 0));
+
+    auto it = seq.insertAfter(seq.begin(), 10);
+    assert(("ListPosition_insertAfter", *it == 10 && seq.get(1) == 10 && seq.get(2) == 1));
+    it = seq.eraseAfter(it);
+    assert(("ListPosition_eraseAfter", *it == 2 && seq.getSize() == 5 && seq.get(2) == 2));
+    seq.eraseAfter(seq.beforeBegin());
+    assert(("ListPosition_eraseFirst", seq.get(0) == 10));
+
+    ListSequence<int> other;
+    other.add(100);
+    other.add(200);
+    seq.spliceAfter(seq.beforeBegin(), other);
+    assert(("ListPosition_splice", other.getSize() == 0 && seq.getSize() == 6 && seq.get(0) == 100 && seq.get(1) == 200));
+    ListSequence<int> tail;
+    tail.add(300);
+    auto last = seq.begin();
+    for (size_t i = 1; i < seq.getSize(); ++i) {
+        ++last;
+    }
+    seq.spliceAfter(last, tail);
+    seq.add(400);
+    assert(("ListPosition_splice_tail", seq.getSize() == 8 && seq.get(6) == 300 && seq.get(7) == 400));
+
+    // Последовательный доступ по индексу идёт через кеш курсора; результат должен совпадать с обходом
+    int index = 0;
+    for (int value : seq) {
+        assert(("ListPosition_cursor", seq.get(index++) == value));
+    }
+    seq.remove(3);
+    seq.insert(1, 7);
+    assert(("ListPosition_cursor_invalidate", seq.get(1) == 7 && seq.get(2) == 200 && seq.get(4) == 3));
+
+    bool thrown = false;
+    try {
+        seq.eraseAfter(seq.end());
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(("ListPosition_eraseAfter_end", thrown));
+}
+
+void testDoublyListOperations() {
+    DoublyListSequence<int> seq;
+    for (int i = 0; i < 5; ++i) {
+        seq.add(i);
+    }
+    auto it = seq.begin();
+    ++it;
+    it = seq.erase(it);
+    assert(("DoublyList_erase", *it == 2 && seq.getSize() == 4));
+    it = seq.insert(it, 10);
+    assert(("DoublyList_insert", *it == 10 && seq.get(1) == 10 && seq.get(2) == 2));
+    seq.popBack();
+    seq.popFront();
+    seq.pushFront(-1);
+    assert(("DoublyList_ends", seq.getSize() == 4 && seq.get(0) == -1 && seq.get(3) == 3));
+    assert(("DoublyList_reverse", *--seq.end() == 3 && *std::prev(seq.end(), 2) == 2));
+
+    DoublyListSequence<int> other;
+    other.add(100);
+    other.add(200);
+    seq.splice(std::next(seq.begin()), other);
+    assert(("DoublyList_splice", other.getSize() == 0 && seq.getSize() == 6 && seq.get(1) == 100 && seq.get(3) == 10));
+
+    for (size_t i = seq.getSize(); i > 0; --i) {
+        assert(("DoublyList_backward_get", seq.get(i - 1) == *std::prev(seq.end(), static_cast<std::ptrdiff_t>(seq.getSize() - i + 1))));
+    }
+}
+
+void testUnrolledListOperations() {
+    // Маленькие блоки, чтобы чаще срабатывали деление, заимствование и слияние
+    UnrolledListSequence<int, 4> seq;
+    std::vector<int> reference;
+    for (int i = 0; i < 200; ++i) {
+        size_t index = (static_cast<size_t>(i) * 7) % (reference.size() + 1);
+        seq.insert(index, i);
+        reference.insert(reference.begin() + static_cast<std::ptrdiff_t>(index), i);
+    }
+    assert(("UnrolledList_insert", std::equal(seq.begin(), seq.end(), reference.begin(), reference.end())));
+    assert(("UnrolledList_fill_insert", seq.getChunkCount() <= reference.size() / 2 + 1));
+
+    for (int i = 0; i < 150; ++i) {
+        size_t index = (static_cast<size_t>(i) * 13) % reference.size();
+        seq.remove(index);
+        reference.erase(reference.begin() + static_cast<std::ptrdiff_t>(index));
+    }
+    assert(("UnrolledList_remove", std::equal(seq.begin(), seq.end(), reference.begin(), reference.end())));
+    assert(("UnrolledList_fill_remove", seq.getChunkCount() <= reference.size() / 2 + 1));
+    for (size_t i = 0; i < reference.size(); ++i) {
+        assert(("UnrolledList_get", seq.get(i) == reference[i]));
+    }
+
+    UnrolledListSequence<int> full;
+    for (int i = 0; i < 1000; ++i) {
+        full.add(i);
+    }
+    assert(("UnrolledList_append_chunks", full.getChunkCount() == 16));
+    assert(("UnrolledList_accumulate", std::accumulate(full.cbegin(), full.cend(), 0) == 499500));
+    while (full.getSize()) {
+        full.remove(0);
+    }
+    assert(("UnrolledList_empty", full.getChunkCount() == 0 && full.begin() == full.end()));
+}
+
 void testSequence() {
     testAddElement<Sequence<int>>();
     testAddMultipleElements<Sequence<int>>();
@@ -153,6 +480,10 @@ void testSequence() {
     testEqualityOperator<Sequence<int>>();
     testInequalityOperator<Sequence<int>>();
     testResize<Sequence<int>>();
+    testSequenceRef<Sequence<int>>();
+    testMoveSemantics<Sequence<CopyCounted>>();
+    testRandomAccessIterator<Sequence<int>>();
+    testFastAccess<Sequence<int>>();
 
     std::cout << "All tests passed! (Sequence)" << std::endl;
 }
@@ -170,6 +501,11 @@ void testListSequence() {
     testEqualityOperator<ListSequence<int>>();
     testInequalityOperator<ListSequence<int>>();
     testResize<ListSequence<int>>();
+    testSequenceRef<ListSequence<int>>();
+    testMoveSemantics<ListSequence<CopyCounted>>();
+    testConcurrentConstGet<ListSequence<int>>();
+    testListIterator();
+    testListPositionOperations();
 
     std::cout << "All tests passed! (ListSequence)" << std::endl;
 }
@@ -187,6 +523,54 @@ void testArraySequence() {
     testEqualityOperator<ArraySequence<int>>();
     testInequalityOperator<ArraySequence<int>>();
     testResize<ArraySequence<int>>();
+    testSequenceRef<ArraySequence<int>>();
+    testMoveSemantics<ArraySequence<CopyCounted>>();
+    testRandomAccessIterator<ArraySequence<int>>();
+    testFastAccess<ArraySequence<int>>();
 
     std::cout << "All tests passed! (ArraySequence)" << std::endl;
-}
\ No newline at end of file
+}
+
+void testDoublyListSequence() {
+    testAddElement<DoublyListSequence<int>>();
+    testAddMultipleElements<DoublyListSequence<int>>();
+    testRemoveElement<DoublyListSequence<int>>();
+    testRemoveOutOfRange<DoublyListSequence<int>>();
+    testGetOutOfRange<DoublyListSequence<int>>();
+    testCopyConstructor<DoublyListSequence<int>>();
+    testMoveConstructor<DoublyListSequence<int>>();
+    testAssignmentOperator<DoublyListSequence<int>>();
+    testSelfAssignment<DoublyListSequence<int>>();
+    testEqualityOperator<DoublyListSequence<int>>();
+    testInequalityOperator<DoublyListSequence<int>>();
+    testResize<DoublyListSequence<int>>();
+    testSequenceRef<DoublyListSequence<int>>();
+    testMoveSemantics<DoublyListSequence<CopyCounted>>();
+    testConcurrentConstGet<DoublyListSequence<int>>();
+    testDoublyListOperations();
+
+    std::cout << "All tests passed! (DoublyListSequence)" << std::endl;
+}
+
+void testUnrolledListSequence() {
+    testAddElement<UnrolledListSequence<int>>();
+    testAddMultipleElements<UnrolledListSequence<int>>();
+    testRemoveElement<UnrolledListSequence<int>>();
+    testRemoveOutOfRange<UnrolledListSequence<int>>();
+    testGetOutOfRange<UnrolledListSequence<int>>();
+    testCopyConstructor<UnrolledListSequence<int>>();
+    testMoveConstructor<UnrolledListSequence<int>>();
+    testAssignmentOperator<UnrolledListSequence<int>>();
+    testSelfAssignment<UnrolledListSequence<int>>();
+    testEqualityOperator<UnrolledListSequence<int>>();
+    testInequalityOperator<UnrolledListSequence<int>>();
+    testResize<UnrolledListSequence<int>>();
+    testSequenceRef<UnrolledListSequence<int>>();
+    testMoveSemantics<UnrolledListSequence<CopyCounted>>();
+    testMoveSemantics<UnrolledListSequence<CopyCounted, 4>>();
+    testConcurrentConstGet<UnrolledListSequence<int>>();
+    testConcurrentConstGet<UnrolledListSequence<int, 4>>();
+    testUnrolledListOperations();
+
+    std::cout << "All tests passed! (UnrolledListSequence)" << std::endl;
+}
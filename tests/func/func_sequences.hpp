@@ -2,7 +2,10 @@
 
 #include "../../include/sequence.hpp"
 #include "../../include/list_sequence.hpp"
+#include "../../include/doubly_list_sequence.hpp"
+#include "../../include/unrolled_list_sequence.hpp"
 #include "../../include/array_sequence.hpp"
+#include "../../include/sequence_ref.hpp"
 
 
 void testAddElement();
@@ -29,8 +32,28 @@ void testInequalityOperator();
 
 void testResize();
 
+void testRandomAccessIterator();
+
+void testListIterator();
+
+void testFastAccess();
+
+void testSequenceRef();
+
+void testMoveSemantics();
+
+void testListPositionOperations();
+
+void testDoublyListOperations();
+
+void testUnrolledListOperations();
+
 void testSequence();
 
 void testListSequence();
 
-void testArraySequence();
\ No newline at end of file
+void testArraySequence();
+
+void testDoublyListSequence();
+
+void testUnrolledListSequence();
\ No newline at end of file
@@ -0,0 +1,389 @@
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "func_sorts.hpp"
+
+
+// Входные данные, на которых простые быстрые сортировки деградируют
+std::vector<int> sortPattern(int pattern, size_t size) {
+    std::mt19937 rng(static_cast<unsigned>(size * 31 + pattern));
+    std::vector<int> values(size);
+    for (size_t i = 0; i < size; ++i) {
+        int index = static_cast<int>(i);
+        switch (pattern) {
+            case 0: values[i] = static_cast<int>(rng()); break;                          // случайные
+            case 1: values[i] = index; break;                                            // отсортированные
+            case 2: values[i] = -index; break;                                           // обратный порядок
+            case 3: values[i] = static_cast<int>(rng() % 4); break;                      // много повторов
+            case 4: values[i] = i < size / 2 ? index : static_cast<int>(size) - index; break; // "пирамида"
+            default: values[i] = index % 16; break;                                       // пилообразные
+        }
+    }
+    return values;
+}
+
+template <typename T>
+bool sameAsStdSort(ArraySequence<T>& seq, std::vector<T> expected) {
+    std::sort(expected.begin(), expected.end());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        if (!(seq.get(i) == expected[i])) {
+            return false;
+        }
+    }
+    return seq.getSize() == expected.size();
+}
+
+void testPdqSortPatterns() {
+    PdqSort<int> sorter;
+    for (int pattern = 0; pattern < 6; ++pattern) {
+        for (size_t size : {0, 1, 2, 23, 24, 25, 129, 1000, 50000}) {
+            std::vector<int> values = sortPattern(pattern, size);
+            ArraySequence<int> seq;
+            for (int value : values) seq.add(value);
+            sorter.sort(seq, compareIntIncrease);
+            assert(("PdqSortPatterns", sameAsStdSort(seq, values)));
+        }
+    }
+
+    ArraySequence<int> seq;
+    for (int value : sortPattern(0, 1000)) seq.add(value);
+    sorter.sort(seq, compareIntDecrease);
+    for (size_t i = 1; i < seq.getSize(); ++i) {
+        assert(("PdqSortPatterns_decrease", seq.get(i - 1) >= seq.get(i)));
+    }
+}
+
+void testPdqSortStrings() {
+    std::vector<std::string> values;
+    ArraySequence<std::string> seq;
+    for (int value : sortPattern(3, 500)) {
+        values.push_back("v" + std::to_string(value * 7919 % 1000));
+        seq.add(values.back());
+    }
+    seq.sort();
+    assert(("PdqSortStrings", sameAsStdSort(seq, values)));
+}
+
+void testPdqSortEdges() {
+    ArraySequence<Edge<std::string>> edges;
+    for (int i = 0; i < 300; ++i) {
+        edges.add(Edge<std::string>("v" + std::to_string(i), "u", i * 37 % 101 - 50));
+    }
+    edges.sort();
+    for (size_t i = 1; i < edges.getSize(); ++i) {
+        assert(("PdqSortEdges_order", edges.get(i - 1).weight <= edges.get(i).weight));
+    }
+    assert(("PdqSortEdges_size", edges.getSize() == 300));
+}
+
+void testPdqSortListSequence() {
+    ListSequence<int> list;
+    for (int i = 0; i < 200; ++i) {
+        list.add(i * 73 % 200);
+    }
+    PdqSort<int>().sort(list, compareIntIncrease);
+    for (int i = 0; i < 200; ++i) {
+        assert(("PdqSortListSequence", list.get(i) == i));
+    }
+}
+
+void testRadixSortPatterns() {
+    RadixSort<int> sorter;
+    RadixSort<int> no_counting(RadixKey<int>(), false);
+    for (int pattern = 0; pattern < 6; ++pattern) {
+        for (size_t size : {0, 1, 2, 63, 64, 65, 1000, 70000}) {
+            std::vector<int> values = sortPattern(pattern, size);
+            ArraySequence<int> seq;
+            ArraySequence<int> lsd;
+            for (int value : values) {
+                seq.add(value);
+                lsd.add(value);
+            }
+            sorter.sort(seq, ascending);
+            no_counting.sort(lsd, ascending);
+            assert(("RadixSortPatterns", sameAsStdSort(seq, values)));
+            assert(("RadixSortPatterns_lsd", sameAsStdSort(lsd, values)));
+        }
+    }
+
+    ArraySequence<int> seq;
+    for (int value : sortPattern(0, 1000)) seq.add(value);
+    sorter.sort(seq, descending);
+    for (size_t i = 1; i < seq.getSize(); ++i) {
+        assert(("RadixSortPatterns_decrease", seq.get(i - 1) >= seq.get(i)));
+    }
+}
+
+void testRadixSortKeys() {
+    std::vector<long long> wide = {LLONG_MAX, LLONG_MIN, 0, -1, 1, LLONG_MIN + 1, LLONG_MAX - 1};
+    std::vector<unsigned> unsigned_values;
+    std::vector<short> narrow;
+    ArraySequence<long long> wide_seq;
+    ArraySequence<unsigned> unsigned_seq;
+    ArraySequence<short> narrow_seq;
+    for (int i = 0; i < 500; ++i) {
+        wide.push_back(static_cast<long long>(static_cast<unsigned long long>(i) * 0x9E3779B97F4A7C15ULL));
+        unsigned_values.push_back(static_cast<unsigned>(i) * 2654435761u);
+        narrow.push_back(static_cast<short>(i * 131 - 30000));
+    }
+    for (auto value : wide) wide_seq.add(value);
+    for (auto value : unsigned_values) unsigned_seq.add(value);
+    for (auto value : narrow) narrow_seq.add(value);
+    wide_seq.sort();
+    unsigned_seq.sort();
+    narrow_seq.sort();
+    assert(("RadixSortKeys_int64", sameAsStdSort(wide_seq, wide)));
+    assert(("RadixSortKeys_unsigned", sameAsStdSort(unsigned_seq, unsigned_values)));
+    assert(("RadixSortKeys_int16", sameAsStdSort(narrow_seq, narrow)));
+}
+
+void testRadixSortEdgesStable() {
+    ArraySequence<Edge<int>> edges;
+    for (int i = 0; i < 5000; ++i) {
+        edges.add(Edge<int>(i, i + 1, (i * 7919) % 41 - 20));
+    }
+    edges.sort();
+    for (size_t i = 1; i < edges.getSize(); ++i) {
+        const Edge<int>& prev = edges.get(i - 1);
+        const Edge<int>& cur = edges.get(i);
+        assert(("RadixSortEdgesStable_order", prev.weight <= cur.weight));
+        assert(("RadixSortEdgesStable_stable", prev.weight < cur.weight || prev.vertex1 < cur.vertex1));
+        assert(("RadixSortEdgesStable_payload", cur.vertex2 == cur.vertex1 + 1));
+    }
+
+    ListSequence<Edge<std::string>> list;
+    for (int i = 0; i < 100; ++i) {
+        list.add(Edge<std::string>("v" + std::to_string(i), "u", 100 - i));
+    }
+    RadixSort<Edge<std::string>>().sort(list);
+    for (int i = 0; i < 100; ++i) {
+        assert(("RadixSortEdgesStable_list", list.get(i).weight == i + 1));
+    }
+
+    // Убывание - тоже устойчивое: равные веса остаются в исходном порядке (и через сортировку подсчётом,
+    // и через LSD, и вставками на малых массивах)
+    for (size_t size : {50, 5000}) {
+        for (bool counting : {true, false}) {
+            ArraySequence<Edge<int>> descending_edges;
+            for (int i = 0; i < static_cast<int>(size); ++i) {
+                descending_edges.add(Edge<int>(i, i + 1, (i * 7919) % 41 - 20));
+            }
+            RadixSort<Edge<int>>(RadixKey<Edge<int>>(), counting).sort(descending_edges, descending);
+            for (size_t i = 1; i < descending_edges.getSize(); ++i) {
+                const Edge<int>& prev = descending_edges.get(i - 1);
+                const Edge<int>& cur = descending_edges.get(i);
+                assert(("RadixSortEdgesStable_descending", prev.weight >= cur.weight));
+                assert(("RadixSortEdgesStable_descending_stable", prev.weight > cur.weight || prev.vertex1 < cur.vertex1));
+            }
+        }
+    }
+    ArraySequence<Edge<int>> by_weight;
+    for (int i = 0; i < 5000; ++i) {
+        by_weight.add(Edge<int>(i, i + 1, i % 7));
+    }
+    by_weight.sortBy(&Edge<int>::weight, descending);
+    for (size_t i = 1; i < by_weight.getSize(); ++i) {
+        const Edge<int>& prev = by_weight.get(i - 1);
+        const Edge<int>& cur = by_weight.get(i);
+        assert(("RadixSortEdgesStable_sortBy", prev.weight > cur.weight ||
+                                               (prev.weight == cur.weight && prev.vertex1 < cur.vertex1)));
+    }
+}
+
+void testParallelSortPatterns() {
+    for (unsigned threads : {1u, 3u, 4u}) {
+        ParallelSort<int> sorter(threads, 100);
+        for (int pattern = 0; pattern < 6; ++pattern) {
+            for (size_t size : {0, 1, 99, 100, 101, 1000, 20011}) {
+                std::vector<int> values = sortPattern(pattern, size);
+                ArraySequence<int> seq;
+                for (int value : values) seq.add(value);
+                sorter.sort(seq, compareIntIncrease);
+                assert(("ParallelSortPatterns", sameAsStdSort(seq, values)));
+            }
+        }
+    }
+
+    std::vector<std::string> values;
+    ArraySequence<std::string> seq;
+    for (int value : sortPattern(0, 5000)) {
+        values.push_back(std::to_string(value));
+        seq.add(values.back());
+    }
+    ParallelSort<std::string>(4, 64).sort(seq, compareStringIncrease);
+    assert(("ParallelSortPatterns_strings", sameAsStdSort(seq, values)));
+}
+
+void testParallelSortStable() {
+    ArraySequence<Edge<int>> edges;
+    for (int i = 0; i < 10000; ++i) {
+        edges.add(Edge<int>(i, i + 1, (i * 7919) % 13));
+    }
+    ParallelSort<Edge<int>> sorter(4, 256, true);
+    sorter.sort(edges, [](const Edge<int>& a, const Edge<int>& b) { return a.weight < b.weight; });
+    for (size_t i = 1; i < edges.getSize(); ++i) {
+        const Edge<int>& prev = edges.get(i - 1);
+        const Edge<int>& cur = edges.get(i);
+        assert(("ParallelSortStable_order", prev.weight <= cur.weight));
+        assert(("ParallelSortStable_stable", prev.weight < cur.weight || prev.vertex1 < cur.vertex1));
+    }
+
+    ListSequence<int> list;
+    for (int i = 0; i < 1000; ++i) {
+        list.add(i * 7 % 1000);
+    }
+    ParallelSort<int>(2, 100).sort(list, compareIntIncrease);
+    for (int i = 0; i < 1000; ++i) {
+        assert(("ParallelSortStable_list", list.get(i) == i));
+    }
+}
+
+void testTemplateComparators() {
+    std::vector<int> values = sortPattern(0, 3000);
+    ArraySequence<int> up;
+    ArraySequence<int> down;
+    ArraySequence<int> lambda;
+    for (int value : values) {
+        up.add(value);
+        down.add(value);
+        lambda.add(value);
+    }
+    up.sort(ascending);
+    down.sort(descending);
+    int mod = 1000;
+    // Лямбда с захватом: раньше не компилировалась, т.к. сводилась к указателю на функцию
+    lambda.sort([mod](int a, int b) { return std::abs(a % mod) < std::abs(b % mod); });
+    assert(("TemplateComparators_ascending", sameAsStdSort(up, values)));
+    for (size_t i = 1; i < values.size(); ++i) {
+        assert(("TemplateComparators_descending", down.get(i - 1) >= down.get(i)));
+        assert(("TemplateComparators_lambda", std::abs(lambda.get(i - 1) % mod) <= std::abs(lambda.get(i) % mod)));
+    }
+
+    ArraySequence<Edge<std::string>> edges;
+    for (int i = 0; i < 500; ++i) {
+        edges.add(Edge<std::string>("v" + std::to_string(i * 7 % 500), "u", i * 31 % 97));
+    }
+    edges.sortBy(&Edge<std::string>::weight, descending);
+    for (size_t i = 1; i < edges.getSize(); ++i) {
+        assert(("TemplateComparators_by_weight", edges.get(i - 1).weight >= edges.get(i).weight));
+    }
+    edges.sortBy(&Edge<std::string>::vertex1);
+    for (size_t i = 1; i < edges.getSize(); ++i) {
+        assert(("TemplateComparators_by_vertex", edges.get(i - 1).vertex1 <= edges.get(i).vertex1));
+    }
+
+    ListSequence<int> list;
+    for (int i = 0; i < 100; ++i) list.add(i * 37 % 100);
+    PdqSort<int>().sort(list, descending);
+    for (int i = 0; i < 100; ++i) {
+        assert(("TemplateComparators_list", list.get(i) == 99 - i));
+    }
+}
+
+void testNthElement() {
+    for (int pattern = 0; pattern < 6; ++pattern) {
+        for (size_t size : {1, 2, 24, 25, 1000, 30000}) {
+            std::vector<int> values = sortPattern(pattern, size);
+            std::vector<int> sorted = values;
+            std::sort(sorted.begin(), sorted.end());
+            for (size_t k : {size_t(0), size / 3, size / 2, size - 1}) {
+                ArraySequence<int> seq;
+                for (int value : values) seq.add(value);
+                nthElement(seq, k);
+                assert(("NthElement_value", seq.get(k) == sorted[k]));
+                for (size_t i = 0; i < size; ++i) {
+                    assert(("NthElement_partition", i < k ? seq.get(i) <= seq.get(k) : seq.get(i) >= seq.get(k)));
+                }
+            }
+        }
+    }
+
+    ListSequence<int> list;
+    for (int i = 0; i < 100; ++i) list.add(i * 37 % 100);
+    nthElement(list, 10, descending);
+    assert(("NthElement_list", list.get(10) == 89));
+
+    ArraySequence<int> empty;
+    try {
+        nthElement(empty, 0);
+        assert(("NthElement_out_of_range", false));
+    } catch (const std::out_of_range&) {
+        assert(("NthElement_OK", true));
+    }
+}
+
+void testPartialSort() {
+    for (int pattern = 0; pattern < 6; ++pattern) {
+        std::vector<int> values = sortPattern(pattern, 5000);
+        std::vector<int> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+        for (size_t k : {0, 1, 10, 100, 4999, 5000, 6000}) {
+            ArraySequence<int> seq;
+            for (int value : values) seq.add(value);
+            partialSort(seq, k);
+            for (size_t i = 0; i < std::min<size_t>(k, values.size()); ++i) {
+                assert(("PartialSort_prefix", seq.get(i) == sorted[i]));
+            }
+            std::vector<int> all;
+            for (int value : seq) all.push_back(value);
+            std::sort(all.begin(), all.end());
+            assert(("PartialSort_permutation", all == sorted));
+        }
+    }
+
+    ArraySequence<Edge<int>> edges;
+    for (int i = 0; i < 1000; ++i) {
+        edges.add(Edge<int>(i, i + 1, i * 7919 % 1000));
+    }
+    partialSort(edges, 5, byKey(&Edge<int>::weight));
+    for (int i = 0; i < 5; ++i) {
+        assert(("PartialSort_edges", edges.get(i).weight == i));
+    }
+}
+
+void testTopK() {
+    std::vector<int> values = sortPattern(0, 10000);
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    ArraySequence<int> seq;
+    for (int value : values) seq.add(value);
+
+    std::vector<int> smallest = topK(seq, 10);
+    std::vector<int> largest = topK(seq, 10, descending);
+    assert(("TopK_size", smallest.size() == 10 && largest.size() == 10));
+    for (size_t i = 0; i < 10; ++i) {
+        assert(("TopK_smallest", smallest[i] == sorted[i]));
+        assert(("TopK_largest", largest[i] == sorted[sorted.size() - 1 - i]));
+    }
+    assert(("TopK_all", topK(seq, 20000) == sorted));
+    assert(("TopK_zero", topK(seq, 0).empty()));
+
+    TopK<Edge<int>, ByKey<int Edge<int>::*>> lightest(3, byKey(&Edge<int>::weight));
+    for (int i = 0; i < 100; ++i) {
+        lightest.add(Edge<int>(i, i + 1, 100 - i));
+    }
+    std::vector<Edge<int>> result = lightest.result();
+    assert(("TopK_stream", lightest.getSize() == 3 && result[0].weight == 1 && result[2].weight == 3));
+}
+
+void testSorts() {
+    testPdqSortPatterns();
+    testPdqSortStrings();
+    testPdqSortEdges();
+    testPdqSortListSequence();
+    testRadixSortPatterns();
+    testRadixSortKeys();
+    testRadixSortEdgesStable();
+    testParallelSortPatterns();
+    testParallelSortStable();
+    testTemplateComparators();
+    testNthElement();
+    testPartialSort();
+    testTopK();
+
+    std::cout << "All tests passed! (Sorts)" << std::endl;
+}
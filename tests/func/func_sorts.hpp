@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../../include/array_sequence.hpp"
+#include "../../include/list_sequence.hpp"
+#include "../../include/graph.hpp"
+
+
+void testPdqSortPatterns();
+
+void testPdqSortStrings();
+
+void testPdqSortEdges();
+
+void testPdqSortListSequence();
+
+void testRadixSortPatterns();
+
+void testRadixSortKeys();
+
+void testRadixSortEdgesStable();
+
+void testParallelSortPatterns();
+
+void testParallelSortStable();
+
+void testTemplateComparators();
+
+void testNthElement();
+
+void testPartialSort();
+
+void testTopK();
+
+void testSorts();